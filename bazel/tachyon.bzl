@@ -118,6 +118,12 @@ def if_x86_64_and_polygon_zkevm_backend(a, b = []):
         "//conditions:default": b,
     })
 
+def if_has_msm_stats(a, b = []):
+    return select({
+        "@kroma_network_tachyon//:tachyon_has_msm_stats": a,
+        "//conditions:default": b,
+    })
+
 def if_has_matplotlib(a, b = []):
     return select({
         "@kroma_network_tachyon//:tachyon_has_matplotlib": a,
@@ -4,6 +4,7 @@ load(
     "//bazel:tachyon.bzl",
     "if_has_exception",
     "if_has_matplotlib",
+    "if_has_msm_stats",
     "if_has_openmp",
     "if_has_rtti",
     "if_linux_x86_64",
@@ -43,6 +44,9 @@ def tachyon_cxxopts(safe_code = True, force_exceptions = False, force_rtti = Fal
 def tachyon_openmp_defines():
     return if_has_openmp(["TACHYON_HAS_OPENMP"])
 
+def tachyon_msm_stats_defines():
+    return if_has_msm_stats(["TACHYON_HAS_MSM_STATS"])
+
 def tachyon_cuda_defines():
     return if_cuda(["TACHYON_CUDA"])
 
@@ -50,7 +54,7 @@ def tachyon_matplotlib_defines():
     return if_has_matplotlib(["TACHYON_HAS_MATPLOTLIB"])
 
 def tachyon_defines(use_cuda = False):
-    defines = tachyon_defines_shared_lib_build() + tachyon_openmp_defines()
+    defines = tachyon_defines_shared_lib_build() + tachyon_openmp_defines() + tachyon_msm_stats_defines()
     if use_cuda:
         defines += tachyon_cuda_defines()
     return defines
@@ -7,6 +7,7 @@
 // clang-format on
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_traits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/msm.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm.h"
 
 namespace tachyon {
 
@@ -51,6 +52,9 @@ int RealMain(int argc, char** argv) {
 
   MSMRunner<bn254::G1AffinePoint> runner(&reporter);
   runner.SetInputs(&test_set.bases, &test_set.scalars);
+  if constexpr (MSMStats::kEnabled) {
+    runner.SetStats(tachyon_bn254_g1_msm_get_stats(msm));
+  }
   std::vector<bn254::G1JacobianPoint> results;
   runner.Run(tachyon_bn254_g1_affine_msm, msm, point_nums, &results);
   for (const MSMConfig::Vendor vendor : config.vendors()) {
@@ -69,6 +73,9 @@ int RealMain(int argc, char** argv) {
   }
 
   reporter.Show();
+  if constexpr (MSMStats::kEnabled) {
+    reporter.ShowStats();
+  }
 
   tachyon_bn254_g1_destroy_msm(msm);
 
@@ -12,6 +12,7 @@
 #include "tachyon/base/time/time.h"
 #include "tachyon/cc/math/elliptic_curves/point_traits.h"
 #include "tachyon/math/base/semigroups.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
 
 namespace tachyon {
 
@@ -40,17 +41,22 @@ class MSMRunner {
     scalars_ = scalars;
   }
 
+  // If set, |stats| is reset before each run of |Run()| and reported after.
+  void SetStats(math::MSMStats* stats) { stats_ = stats; }
+
   template <typename Fn, typename MSMPtr>
   void Run(Fn fn, MSMPtr msm, const std::vector<uint64_t>& point_nums,
            std::vector<ReturnTy>* results) {
     results->clear();
     for (size_t i = 0; i < point_nums.size(); ++i) {
+      if (stats_) stats_->Reset();
       base::TimeTicks now = base::TimeTicks::Now();
       std::unique_ptr<CReturnTy> ret;
       ret.reset(fn(msm, reinterpret_cast<const CPointTy*>(bases_->data()),
                    reinterpret_cast<const CScalarField*>(scalars_->data()),
                    point_nums[i]));
       reporter_->AddResult(i, (base::TimeTicks::Now() - now).InSecondsF());
+      if (stats_) reporter_->AddStats(i, *stats_);
       results->push_back(*reinterpret_cast<ReturnTy*>(ret.get()));
     }
   }
@@ -76,6 +82,8 @@ class MSMRunner {
   const std::vector<PointTy>* bases_ = nullptr;
   // not owned
   const std::vector<ScalarField>* scalars_ = nullptr;
+  // not owned
+  math::MSMStats* stats_ = nullptr;
 };
 
 }  // namespace tachyon
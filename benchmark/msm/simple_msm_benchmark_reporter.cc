@@ -5,6 +5,7 @@
 
 #include "absl/strings/substitute.h"
 
+#include "tachyon/base/console/table_writer.h"
 #include "tachyon/base/strings/string_number_conversions.h"
 
 namespace tachyon {
@@ -17,6 +18,7 @@ SimpleMSMBenchmarkReporter::SimpleMSMBenchmarkReporter(
     targets_.push_back(base::NumberToString(num));
   }
   results_.resize(nums.size());
+  stats_.resize(nums.size());
   AddVendor("tachyon");
 }
 
@@ -24,4 +26,32 @@ void SimpleMSMBenchmarkReporter::AddVendor(std::string_view name) {
   column_headers_.push_back(std::string(name));
 }
 
+void SimpleMSMBenchmarkReporter::ShowStats() {
+  base::TableWriterBuilder builder;
+  builder.AlignHeaderLeft()
+      .AddSpace(1)
+      .FitToTerminalWidth()
+      .StripTrailingAsciiWhitespace()
+      .AddColumn("");
+  for (size_t i = 0; i < math::kMSMPhaseNums; ++i) {
+    builder.AddColumn(
+        std::string(math::MSMPhaseToString(static_cast<math::MSMPhase>(i))));
+  }
+  builder.AddColumn("buckets");
+  base::TableWriter writer = builder.Build();
+
+  for (size_t i = 0; i < targets_.size(); ++i) {
+    writer.SetElement(i, 0, targets_[i]);
+    for (size_t j = 0; j < math::kMSMPhaseNums; ++j) {
+      writer.SetElement(
+          i, j + 1,
+          base::NumberToString(
+              stats_[i].GetTime(static_cast<math::MSMPhase>(j)).InSecondsF()));
+    }
+    writer.SetElement(i, math::kMSMPhaseNums + 1,
+                      base::NumberToString(stats_[i].GetBucketNums()));
+  }
+  writer.Print(true);
+}
+
 }  // namespace tachyon
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "benchmark/simple_benchmark_reporter.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
 
 namespace tachyon {
 
@@ -17,8 +18,17 @@ class SimpleMSMBenchmarkReporter : public SimpleBenchmarkReporter {
 
   void AddVendor(std::string_view name);
 
+  void AddStats(size_t idx, const math::MSMStats& stats) {
+    stats_[idx] = stats;
+  }
+
+  // Shows the time of each phase of the tachyon MSMs, which is only recorded
+  // when built with --config msm_stats.
+  void ShowStats();
+
  private:
   std::vector<uint64_t> nums_;
+  std::vector<math::MSMStats> stats_;
 };
 
 }  // namespace tachyon
@@ -177,6 +177,15 @@
 #endif  // defined(COMPILER_GCC)
 #endif  // !defined(LIKELY)
 
+// Macro for hinting that the memory at |addr| is going to be read soon.
+#if !defined(PREFETCH_FOR_READ)
+#if defined(COMPILER_GCC) || defined(__clang__)
+#define PREFETCH_FOR_READ(addr) __builtin_prefetch(addr, 0)
+#else
+#define PREFETCH_FOR_READ(addr) ((void)(addr))
+#endif  // defined(COMPILER_GCC)
+#endif  // !defined(PREFETCH_FOR_READ)
+
 // Compiler feature-detection.
 // clang.llvm.org/docs/LanguageExtensions.html#has-feature-and-has-extension
 #if defined(__has_feature)
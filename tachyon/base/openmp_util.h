@@ -1,14 +1,34 @@
 #ifndef TACHYON_BASE_OPENMP_UTIL_H_
 #define TACHYON_BASE_OPENMP_UTIL_H_
 
+#include <stddef.h>
+
 #if defined(TACHYON_HAS_OPENMP)
 #include <omp.h>
 #endif  // defined(TACHYON_HAS_OPENMP)
 
 #if defined(TACHYON_HAS_OPENMP)
 #define OPENMP_PARALLEL_FOR(expr) _Pragma("omp parallel for") for (expr)
+// Hands out iterations one by one to whichever thread is free, which balances
+// iterations whose costs vary.
+#define OPENMP_PARALLEL_FOR_DYNAMIC(expr) \
+  _Pragma("omp parallel for schedule(dynamic, 1)") for (expr)
 #else
 #define OPENMP_PARALLEL_FOR(expr) for (expr)
+#define OPENMP_PARALLEL_FOR_DYNAMIC(expr) for (expr)
 #endif  // defined(TACHYON_HAS_OPENMP)
 
+namespace tachyon::base {
+
+// Returns the number of threads a parallel region runs on.
+inline size_t GetNumOpenMPThreads() {
+#if defined(TACHYON_HAS_OPENMP)
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+}
+
+}  // namespace tachyon::base
+
 #endif  // TACHYON_BASE_OPENMP_UTIL_H_
@@ -2,18 +2,25 @@
 #define TACHYON_C_API_H_
 
 #include "tachyon/c/math/elliptic_curves/bls/bls12_381/fq.h"
+#include "tachyon/c/math/elliptic_curves/bls/bls12_381/fq2.h"
 #include "tachyon/c/math/elliptic_curves/bls/bls12_381/fr.h"
 #include "tachyon/c/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/c/math/elliptic_curves/bls/bls12_381/g2.h"
+#include "tachyon/c/math/elliptic_curves/bls/bls12_381/g2_msm.h"
 #include "tachyon/c/math/elliptic_curves/bls/bls12_381/msm.h"
 // Uncomment the following line.
 // See //tachyon/c/math/elliptic_curves/generator:build_defs.bzl
 // #include "tachyon/c/math/elliptic_curves/bls/bls12_381/msm_gpu.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/fq2.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/g2_msm.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/msm.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/msm_gpu.h"
 #include "tachyon/c/math/elliptic_curves/msm/algorithm.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_async.h"
 #include "tachyon/c/version.h"
 
 #endif  // TACHYON_C_API_H_
@@ -43,6 +43,7 @@ def generate_ec_points(
         fr_limb_nums,
         g1_deps,
         g1_gpu_deps,
+        g2_deps,
         g1_msm_kernels_deps = []):
     for n in [
         ("gen_fq_hdr", "fq.h"),
@@ -54,8 +55,14 @@ def generate_ec_points(
         ("gen_fq_prime_field_traits", "fq_prime_field_traits.h"),
         ("gen_fr_prime_field_traits", "fr_prime_field_traits.h"),
         ("gen_g1_point_traits", "g1_point_traits.h"),
+        ("gen_fq2_hdr", "fq2.h"),
+        ("gen_g2_hdr", "g2.h"),
+        ("gen_g2_src", "g2.cc"),
+        ("gen_g2_point_traits", "g2_point_traits.h"),
         ("gen_msm_hdr", "msm.h"),
         ("gen_msm_src", "msm.cc"),
+        ("gen_g2_msm_hdr", "g2_msm.h"),
+        ("gen_g2_msm_src", "g2_msm.cc"),
         ("gen_msm_gpu_hdr", "msm_gpu.h"),
         ("gen_msm_gpu_src", "msm_gpu.cc"),
     ]:
@@ -108,6 +115,21 @@ def generate_ec_points(
         ],
     )
 
+    tachyon_cc_library(
+        name = "g2",
+        hdrs = [
+            "fq2.h",
+            "g2.h",
+            "g2_point_traits.h",
+        ],
+        srcs = ["g2.cc"],
+        deps = g2_deps + [
+            ":fq",
+            ":fr",
+            "//tachyon/cc/math/elliptic_curves:point_conversions",
+        ],
+    )
+
     tachyon_cc_library(
         name = "msm",
         hdrs = ["msm.h"],
@@ -115,6 +137,19 @@ def generate_ec_points(
         deps = [
             ":g1",
             "//tachyon/c/math/elliptic_curves/msm",
+            "//tachyon/c/math/elliptic_curves/msm:msm_job",
+            "//tachyon/c/math/elliptic_curves/msm:msm_stats",
+        ],
+    )
+
+    tachyon_cc_library(
+        name = "g2_msm",
+        hdrs = ["g2_msm.h"],
+        srcs = ["g2_msm.cc"],
+        deps = [
+            ":g2",
+            "//tachyon/c/math/elliptic_curves/msm",
+            "//tachyon/c/math/elliptic_curves/msm:msm_stats",
         ],
     )
 
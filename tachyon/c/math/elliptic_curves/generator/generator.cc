@@ -45,6 +45,12 @@ struct GenerationConfig : public build::CcWriter {
   int GenerateG1Src() const;
   int GenerateMSMHdr() const;
   int GenerateMSMSrc() const;
+  int GenerateFq2Hdr() const;
+  int GenerateG2Hdr() const;
+  int GenerateG2Src() const;
+  int GenerateG2TraitsHdr() const;
+  int GenerateG2MSMHdr() const;
+  int GenerateG2MSMSrc() const;
   int GenerateMSMGpuHdr() const;
   int GenerateMSMGpuSrc() const;
 };
@@ -739,6 +745,7 @@ int GenerationConfig::GenerateMSMHdr() const {
       "#include \"tachyon/c/export.h\"",
       "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/fr.h\"",
       "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g1.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/msm/msm_stats.h\"",
       "",
       "%{extern_c_front}",
       "",
@@ -748,6 +755,9 @@ int GenerationConfig::GenerateMSMHdr() const {
       "",
       "TACHYON_C_EXPORT void tachyon_%{type}_g1_destroy_msm(tachyon_%{type}_g1_msm_ptr ptr);",
       "",
+      "// Returns the stats which the MSMs of |ptr| add to. It is owned by |ptr|.",
+      "TACHYON_C_EXPORT tachyon_msm_stats* tachyon_%{type}_g1_msm_get_stats(tachyon_%{type}_g1_msm_ptr ptr);",
+      "",
       "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_point2_msm(",
       "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_point2* bases,",
       "    const tachyon_%{type}_fr* scalars, size_t size);",
@@ -755,6 +765,42 @@ int GenerationConfig::GenerateMSMHdr() const {
       "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_affine_msm(",
       "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_affine* bases,",
       "    const tachyon_%{type}_fr* scalars, size_t size);",
+      "",
+      "typedef struct tachyon_%{type}_g1_msm_bases* tachyon_%{type}_g1_msm_bases_ptr;",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_point2(",
+      "    const tachyon_%{type}_g1_point2* bases, size_t size);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_affine(",
+      "    const tachyon_%{type}_g1_affine* bases, size_t size);",
+      "",
+      "TACHYON_C_EXPORT void tachyon_%{type}_g1_destroy_msm_bases(tachyon_%{type}_g1_msm_bases_ptr ptr);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_with_bases(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, tachyon_%{type}_g1_msm_bases_ptr bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size);",
+      "",
+      "typedef struct tachyon_%{type}_g1_msm_job* tachyon_%{type}_g1_msm_job_ptr;",
+      "",
+      "typedef void (*tachyon_%{type}_g1_msm_job_callback)(tachyon_%{type}_g1_msm_job_ptr job, void* user_data);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_msm_job_ptr tachyon_%{type}_g1_point2_msm_async(",
+      "    const tachyon_%{type}_g1_point2* bases, const tachyon_%{type}_fr* scalars, size_t size,",
+      "    tachyon_%{type}_g1_msm_job_callback callback, void* user_data);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_msm_job_ptr tachyon_%{type}_g1_affine_msm_async(",
+      "    const tachyon_%{type}_g1_affine* bases, const tachyon_%{type}_fr* scalars, size_t size,",
+      "    tachyon_%{type}_g1_msm_job_callback callback, void* user_data);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_msm_job_ptr tachyon_%{type}_g1_msm_with_bases_async(",
+      "    tachyon_%{type}_g1_msm_bases_ptr bases, const tachyon_%{type}_fr* scalars, size_t size,",
+      "    tachyon_%{type}_g1_msm_job_callback callback, void* user_data);",
+      "",
+      "TACHYON_C_EXPORT bool tachyon_%{type}_g1_msm_job_poll(tachyon_%{type}_g1_msm_job_ptr job);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_job_wait(tachyon_%{type}_g1_msm_job_ptr job);",
+      "",
+      "TACHYON_C_EXPORT void tachyon_%{type}_g1_destroy_msm_job(tachyon_%{type}_g1_msm_job_ptr job);",
   };
   // clang-format on
   std::string tpl_content = absl::StrJoin(tpl, "\n");
@@ -772,6 +818,7 @@ int GenerationConfig::GenerateMSMSrc() const {
   std::string_view tpl[] = {
       "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g1_point_traits.h\"",
       "#include \"tachyon/c/math/elliptic_curves/msm/msm.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/msm/msm_job.h\"",
       "#include \"tachyon/math/elliptic_curves/%{header_dir_name}/g1.h\"",
       "",
       "struct tachyon_%{type}_g1_msm : public tachyon::c::math::MSMApi<tachyon::math::%{type}::G1AffinePoint> {",
@@ -786,6 +833,10 @@ int GenerationConfig::GenerateMSMSrc() const {
       "  delete ptr;",
       "}",
       "",
+      "tachyon_msm_stats* tachyon_%{type}_g1_msm_get_stats(tachyon_%{type}_g1_msm_ptr ptr) {",
+      "  return &ptr->stats;",
+      "}",
+      "",
       "tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_point2_msm(",
       "    tachyon_%{type}_g1_msm_ptr ptr, const tachyon_%{type}_g1_point2* bases,",
       "    const tachyon_%{type}_fr* scalars, size_t size) {",
@@ -799,6 +850,374 @@ int GenerationConfig::GenerateMSMSrc() const {
       "  return tachyon::c::math::DoMSM<tachyon::math::%{type}::G1JacobianPoint>(",
       "      *ptr, bases, scalars, size);",
       "}",
+      "",
+      "struct tachyon_%{type}_g1_msm_bases : public tachyon::c::math::MSMBases<tachyon::math::%{type}::G1AffinePoint> {",
+      "  using tachyon::c::math::MSMBases<tachyon::math::%{type}::G1AffinePoint>::MSMBases;",
+      "};",
+      "",
+      "tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_point2(",
+      "    const tachyon_%{type}_g1_point2* bases, size_t size) {",
+      "  return new tachyon_%{type}_g1_msm_bases(bases, size);",
+      "}",
+      "",
+      "tachyon_%{type}_g1_msm_bases_ptr tachyon_%{type}_g1_create_msm_bases_from_affine(",
+      "    const tachyon_%{type}_g1_affine* bases, size_t size) {",
+      "  return new tachyon_%{type}_g1_msm_bases(bases, size);",
+      "}",
+      "",
+      "void tachyon_%{type}_g1_destroy_msm_bases(tachyon_%{type}_g1_msm_bases_ptr ptr) {",
+      "  delete ptr;",
+      "}",
+      "",
+      "tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_with_bases(",
+      "    tachyon_%{type}_g1_msm_ptr ptr, tachyon_%{type}_g1_msm_bases_ptr bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size) {",
+      "  return tachyon::c::math::DoMSMWithBases<tachyon::math::%{type}::G1JacobianPoint>(",
+      "      *ptr, *bases, scalars, size);",
+      "}",
+      "",
+      "struct tachyon_%{type}_g1_msm_job : public tachyon::c::math::MSMJob<tachyon::math::%{type}::G1AffinePoint> {",
+      "};",
+      "",
+      "tachyon_%{type}_g1_msm_job_ptr tachyon_%{type}_g1_point2_msm_async(",
+      "    const tachyon_%{type}_g1_point2* bases, const tachyon_%{type}_fr* scalars, size_t size,",
+      "    tachyon_%{type}_g1_msm_job_callback callback, void* user_data) {",
+      "  tachyon_%{type}_g1_msm_job_ptr job = new tachyon_%{type}_g1_msm_job();",
+      "  job->Start(bases, scalars, size,",
+      "             tachyon::c::math::BindMSMJobCallback(callback, job, user_data));",
+      "  return job;",
+      "}",
+      "",
+      "tachyon_%{type}_g1_msm_job_ptr tachyon_%{type}_g1_affine_msm_async(",
+      "    const tachyon_%{type}_g1_affine* bases, const tachyon_%{type}_fr* scalars, size_t size,",
+      "    tachyon_%{type}_g1_msm_job_callback callback, void* user_data) {",
+      "  tachyon_%{type}_g1_msm_job_ptr job = new tachyon_%{type}_g1_msm_job();",
+      "  job->Start(bases, scalars, size,",
+      "             tachyon::c::math::BindMSMJobCallback(callback, job, user_data));",
+      "  return job;",
+      "}",
+      "",
+      "tachyon_%{type}_g1_msm_job_ptr tachyon_%{type}_g1_msm_with_bases_async(",
+      "    tachyon_%{type}_g1_msm_bases_ptr bases, const tachyon_%{type}_fr* scalars, size_t size,",
+      "    tachyon_%{type}_g1_msm_job_callback callback, void* user_data) {",
+      "  tachyon_%{type}_g1_msm_job_ptr job = new tachyon_%{type}_g1_msm_job();",
+      "  job->Start(*bases, scalars, size,",
+      "             tachyon::c::math::BindMSMJobCallback(callback, job, user_data));",
+      "  return job;",
+      "}",
+      "",
+      "bool tachyon_%{type}_g1_msm_job_poll(tachyon_%{type}_g1_msm_job_ptr job) {",
+      "  return job->IsDone();",
+      "}",
+      "",
+      "tachyon_%{type}_g1_jacobian* tachyon_%{type}_g1_msm_job_wait(tachyon_%{type}_g1_msm_job_ptr job) {",
+      "  return tachyon::c::math::WaitMSMJob<tachyon::math::%{type}::G1JacobianPoint>(*job);",
+      "}",
+      "",
+      "void tachyon_%{type}_g1_destroy_msm_job(tachyon_%{type}_g1_msm_job_ptr job) {",
+      "  delete job;",
+      "}",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                   });
+  return WriteSrc(content);
+}
+
+int GenerationConfig::GenerateFq2Hdr() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include \"tachyon/c/export.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/fq.h\"",
+      "",
+      "%{extern_c_front}",
+      "",
+      "// An element c0 + c1 * u of the quadratic extension of fq, where both",
+      "// coefficients are in Montgomery form.",
+      "struct TACHYON_C_EXPORT tachyon_%{type}_fq2 {",
+      "  tachyon_%{type}_fq c0;",
+      "  tachyon_%{type}_fq c1;",
+      "};",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                   });
+  return WriteHdr(content, true);
+}
+
+int GenerationConfig::GenerateG2Hdr() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include \"tachyon/c/export.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/fq2.h\"",
+      "",
+      "%{extern_c_front}",
+      "",
+      "struct TACHYON_C_EXPORT __attribute__((aligned(%{alignment}))) %{g2}_affine {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  // needs to occupy the same bytes as G2AffinePoint",
+      "  // See LimbsAlignment() in tachyon/math/base/big_int.h",
+      "  bool infinity;",
+      "};",
+      "",
+      "struct TACHYON_C_EXPORT %{g2}_projective {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "};",
+      "",
+      "struct TACHYON_C_EXPORT %{g2}_jacobian {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "};",
+      "",
+      "struct TACHYON_C_EXPORT %{g2}_xyzz {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 zz;",
+      "  tachyon_%{type}_fq2 zzz;",
+      "};",
+      "",
+      "struct TACHYON_C_EXPORT %{g2}_point2 {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "};",
+      "",
+      "struct TACHYON_C_EXPORT %{g2}_point3 {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "};",
+      "",
+      "struct TACHYON_C_EXPORT %{g2}_point4 {",
+      "  tachyon_%{type}_fq2 x;",
+      "  tachyon_%{type}_fq2 y;",
+      "  tachyon_%{type}_fq2 z;",
+      "  tachyon_%{type}_fq2 w;",
+      "};",
+      "",
+      "TACHYON_C_EXPORT void %{g2}_init();",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  // See LimbsAlignment() in tachyon/math/base/big_int.h.
+  int alignment =
+      fq_limb_nums % 4 == 0 ? 32 : (fq_limb_nums % 2 == 0 ? 16 : 8);
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{alignment}", base::NumberToString(alignment)},
+                       {"%{type}", type},
+                       {"%{g2}", absl::Substitute("tachyon_$0_g2", type)},
+                   });
+  return WriteHdr(content, true);
+}
+
+int GenerationConfig::GenerateG2Src() const {
+  // clang-format off
+  std::vector<std::string_view> tpl = {
+      "#include \"tachyon/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "",
+      "static_assert(sizeof(%{g2}_affine) ==",
+      "              sizeof(tachyon::math::%{type}::G2AffinePoint));",
+      "static_assert(sizeof(%{g2}_jacobian) ==",
+      "              sizeof(tachyon::math::%{type}::G2JacobianPoint));",
+      "",
+      "void %{g2}_init() {",
+      "  tachyon::math::%{type}::G2Curve::Init();",
+      "}",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                       {"%{g2}", absl::Substitute("tachyon_$0_g2", type)},
+                   });
+  return WriteSrc(content);
+}
+
+int GenerationConfig::GenerateG2TraitsHdr() const {
+  std::vector<std::string_view> tpl = {
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/fr.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "#include \"tachyon/cc/math/elliptic_curves/point_traits.h\"",
+      "#include \"tachyon/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "",
+      "namespace tachyon::cc::math {",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2AffinePoint> {",
+      "  using CPointTy = tachyon_%{type}_g2_point2;",
+      "  using CCurvePointTy = tachyon_%{type}_g2_affine;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2ProjectivePoint> {",
+      "  using CPointTy = tachyon_%{type}_g2_point3;",
+      "  using CCurvePointTy = tachyon_%{type}_g2_projective;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2JacobianPoint> {",
+      "  using CPointTy = tachyon_%{type}_g2_point3;",
+      "  using CCurvePointTy = tachyon_%{type}_g2_jacobian;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon::math::%{type}::G2PointXYZZ> {",
+      "  using CPointTy = tachyon_%{type}_g2_point4;",
+      "  using CCurvePointTy = tachyon_%{type}_g2_xyzz;",
+      "  using CScalarField = tachyon_%{type}_fr;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_affine> {",
+      "  using PointTy = tachyon::math::Point2<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePointTy = tachyon::math::%{type}::G2AffinePoint;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_projective> {",
+      "  using PointTy = tachyon::math::Point3<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePointTy = tachyon::math::%{type}::G2ProjectivePoint;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_jacobian> {",
+      "  using PointTy = tachyon::math::Point3<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePointTy = tachyon::math::%{type}::G2JacobianPoint;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_xyzz> {",
+      "  using PointTy = tachyon::math::Point4<tachyon::math::%{type}::Fq2>;",
+      "  using CurvePointTy = tachyon::math::%{type}::G2PointXYZZ;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_point2> {",
+      "  using PointTy = tachyon::math::Point2<tachyon::math::%{type}::Fq2>;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_point3> {",
+      "  using PointTy = tachyon::math::Point3<tachyon::math::%{type}::Fq2>;",
+      "};",
+      "",
+      "template <>",
+      "struct PointTraits<tachyon_%{type}_g2_point4> {",
+      "  using PointTy = tachyon::math::Point4<tachyon::math::%{type}::Fq2>;",
+      "};",
+      "",
+      "}  // namespace tachyon::cc::math",
+  };
+
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                   });
+  return WriteHdr(content, false);
+}
+
+int GenerationConfig::GenerateG2MSMHdr() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include <stddef.h>",
+      "#include <stdint.h>",
+      "",
+      "#include \"tachyon/c/export.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/fr.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/msm/msm_stats.h\"",
+      "",
+      "%{extern_c_front}",
+      "",
+      "typedef struct tachyon_%{type}_g2_msm* tachyon_%{type}_g2_msm_ptr;",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g2_msm_ptr tachyon_%{type}_g2_create_msm(uint8_t degree);",
+      "",
+      "TACHYON_C_EXPORT void tachyon_%{type}_g2_destroy_msm(tachyon_%{type}_g2_msm_ptr ptr);",
+      "",
+      "// Returns the stats which the MSMs of |ptr| add to. It is owned by |ptr|.",
+      "TACHYON_C_EXPORT tachyon_msm_stats* tachyon_%{type}_g2_msm_get_stats(tachyon_%{type}_g2_msm_ptr ptr);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_point2_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_point2* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size);",
+      "",
+      "TACHYON_C_EXPORT tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_affine_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_affine* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size);",
+  };
+  // clang-format on
+  std::string tpl_content = absl::StrJoin(tpl, "\n");
+
+  std::string content = absl::StrReplaceAll(
+      tpl_content, {
+                       {"%{header_dir_name}", c::math::GetLocation(type)},
+                       {"%{type}", type},
+                   });
+  return WriteHdr(content, true);
+}
+
+int GenerationConfig::GenerateG2MSMSrc() const {
+  // clang-format off
+  std::string_view tpl[] = {
+      "#include \"tachyon/c/math/elliptic_curves/%{header_dir_name}/g2_point_traits.h\"",
+      "#include \"tachyon/c/math/elliptic_curves/msm/msm.h\"",
+      "#include \"tachyon/math/elliptic_curves/%{header_dir_name}/g2.h\"",
+      "",
+      "struct tachyon_%{type}_g2_msm : public tachyon::c::math::MSMApi<tachyon::math::%{type}::G2AffinePoint> {",
+      "  using tachyon::c::math::MSMApi<tachyon::math::%{type}::G2AffinePoint>::MSMApi;",
+      "};",
+      "",
+      "tachyon_%{type}_g2_msm_ptr tachyon_%{type}_g2_create_msm(uint8_t degree) {",
+      "  return new tachyon_%{type}_g2_msm(degree);",
+      "}",
+      "",
+      "void tachyon_%{type}_g2_destroy_msm(tachyon_%{type}_g2_msm_ptr ptr) {",
+      "  delete ptr;",
+      "}",
+      "",
+      "tachyon_msm_stats* tachyon_%{type}_g2_msm_get_stats(tachyon_%{type}_g2_msm_ptr ptr) {",
+      "  return &ptr->stats;",
+      "}",
+      "",
+      "tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_point2_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_point2* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size) {",
+      "  return tachyon::c::math::DoMSM<tachyon::math::%{type}::G2JacobianPoint>(",
+      "      *ptr, bases, scalars, size);",
+      "}",
+      "",
+      "tachyon_%{type}_g2_jacobian* tachyon_%{type}_g2_affine_msm(",
+      "    tachyon_%{type}_g2_msm_ptr ptr, const tachyon_%{type}_g2_affine* bases,",
+      "    const tachyon_%{type}_fr* scalars, size_t size) {",
+      "  return tachyon::c::math::DoMSM<tachyon::math::%{type}::G2JacobianPoint>(",
+      "      *ptr, bases, scalars, size);",
+      "}",
   };
   // clang-format on
   std::string tpl_content = absl::StrJoin(tpl, "\n");
@@ -954,6 +1373,18 @@ int RealMain(int argc, char** argv) {
     return config.GenerateG1Src();
   } else if (base::EndsWith(config.out.value(), "g1_point_traits.h")) {
     return config.GenerateG1TraitsHdr();
+  } else if (base::EndsWith(config.out.value(), "fq2.h")) {
+    return config.GenerateFq2Hdr();
+  } else if (base::EndsWith(config.out.value(), "g2.h")) {
+    return config.GenerateG2Hdr();
+  } else if (base::EndsWith(config.out.value(), "g2.cc")) {
+    return config.GenerateG2Src();
+  } else if (base::EndsWith(config.out.value(), "g2_point_traits.h")) {
+    return config.GenerateG2TraitsHdr();
+  } else if (base::EndsWith(config.out.value(), "g2_msm.h")) {
+    return config.GenerateG2MSMHdr();
+  } else if (base::EndsWith(config.out.value(), "g2_msm.cc")) {
+    return config.GenerateG2MSMSrc();
   } else if (base::EndsWith(config.out.value(), "msm.h")) {
     return config.GenerateMSMHdr();
   } else if (base::EndsWith(config.out.value(), "msm.cc")) {
@@ -0,0 +1,72 @@
+#include "tachyon/c/math/elliptic_curves/bn/bn254/g2_msm.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/c/math/elliptic_curves/bn/bn254/g2_point_traits.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+constexpr size_t kNums[] = {32, 2, 5};
+
+class G2MSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() {
+    tachyon_bn254_g2_init();
+
+    size_t max_num = *std::max_element(std::begin(kNums), std::end(kNums));
+    msm_ = tachyon_bn254_g2_create_msm(base::bits::Log2Ceiling(max_num));
+    for (size_t n : kNums) {
+      test_sets_.push_back(
+          MSMTestSet<bn254::G2AffinePoint>::Random(n, MSMMethod::kNaive));
+    }
+  }
+
+  static void TearDownTestSuite() { tachyon_bn254_g2_destroy_msm(msm_); }
+
+ protected:
+  static tachyon_bn254_g2_msm_ptr msm_;
+  static std::vector<MSMTestSet<bn254::G2AffinePoint>> test_sets_;
+};
+
+tachyon_bn254_g2_msm_ptr G2MSMTest::msm_;
+std::vector<MSMTestSet<bn254::G2AffinePoint>> G2MSMTest::test_sets_;
+
+}  // namespace
+
+TEST_F(G2MSMTest, MSMPoint2) {
+  for (const MSMTestSet<bn254::G2AffinePoint>& t : test_sets_) {
+    std::unique_ptr<tachyon_bn254_g2_jacobian> ret;
+    // The coordinates of |tachyon_bn254_g2_point2| are in Montgomery form.
+    std::vector<Point2<bn254::Fq2::MontgomeryTy>> bases = base::CreateVector(
+        t.bases.size(), [&t](size_t i) { return t.bases[i].ToMontgomery(); });
+    ret.reset(tachyon_bn254_g2_point2_msm(
+        msm_, reinterpret_cast<const tachyon_bn254_g2_point2*>(bases.data()),
+        reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+        t.scalars.size()));
+    EXPECT_EQ(*reinterpret_cast<const bn254::G2JacobianPoint*>(ret.get()),
+              t.answer.ToJacobian());
+  }
+}
+
+TEST_F(G2MSMTest, MSMG2Affine) {
+  for (const MSMTestSet<bn254::G2AffinePoint>& t : test_sets_) {
+    std::unique_ptr<tachyon_bn254_g2_jacobian> ret;
+    ret.reset(tachyon_bn254_g2_affine_msm(
+        msm_, reinterpret_cast<const tachyon_bn254_g2_affine*>(t.bases.data()),
+        reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+        t.scalars.size()));
+    EXPECT_EQ(*reinterpret_cast<const bn254::G2JacobianPoint*>(ret.get()),
+              t.answer.ToJacobian());
+  }
+}
+
+}  // namespace tachyon::math
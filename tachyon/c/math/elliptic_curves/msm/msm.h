@@ -4,19 +4,27 @@
 #include <tuple>
 
 #include "tachyon/base/console/console_stream.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_bases.h"
 #include "tachyon/c/math/elliptic_curves/msm/msm_input_provider.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_stats.h"
 #include "tachyon/cc/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 
+struct tachyon_msm_stats : public tachyon::math::MSMStats {};
+
 namespace tachyon::c::math {
 
 template <typename PointTy>
 struct MSMApi {
   MSMInputProvider<PointTy> provider;
   tachyon::math::VariableBaseMSM<PointTy> msm;
+  tachyon_msm_stats stats;
 
   explicit MSMApi(uint8_t degree) {
+    msm.SetStats(&stats);
     // NOTE(chokobole): This constructor accepts |degree| for compatibility with
     // a constructor of MSMGpuApi. We should consider whether it accepts an
     // argument for algorithm selection even though it only supports pippenger
@@ -50,6 +58,29 @@ CRetPointTy* DoMSM(MSMApi<PointTy>& msm_api, const CPointTy* bases,
   return cret;
 }
 
+// Runs an MSM of |scalars| over the first |size| of |bases|, which were
+// converted when registered.
+template <
+    typename RetPointTy, typename PointTy, typename CScalarField,
+    typename CRetPointTy =
+        typename cc::math::PointTraits<RetPointTy>::CCurvePointTy,
+    typename Bucket = typename tachyon::math::VariableBaseMSM<PointTy>::Bucket>
+CRetPointTy* DoMSMWithBases(MSMApi<PointTy>& msm_api,
+                            const MSMBases<PointTy>& bases,
+                            const CScalarField* scalars, size_t size) {
+  CHECK_LE(size, bases.size());
+  using ScalarField = typename PointTy::ScalarField;
+  Bucket bucket;
+  CHECK(msm_api.msm.Run(
+      bases.bases(size),
+      absl::MakeConstSpan(reinterpret_cast<const ScalarField*>(scalars), size),
+      &bucket));
+  auto ret = tachyon::math::ConvertPoint<RetPointTy>(bucket);
+  CRetPointTy* cret = new CRetPointTy();
+  cc::math::ToCPoint3(ret, cret);
+  return cret;
+}
+
 }  // namespace tachyon::c::math
 
 #endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_H_
@@ -0,0 +1,12 @@
+#include "tachyon/c/math/elliptic_curves/msm/msm_async.h"
+
+#include "tachyon/c/math/elliptic_curves/msm/msm_worker_pool.h"
+
+size_t tachyon_msm_async_get_max_concurrency() {
+  return tachyon::c::math::MSMWorkerPool::GetInstance().GetMaxConcurrency();
+}
+
+void tachyon_msm_async_set_max_concurrency(size_t max_concurrency) {
+  tachyon::c::math::MSMWorkerPool::GetInstance().SetMaxConcurrency(
+      max_concurrency);
+}
@@ -0,0 +1,24 @@
+#ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_ASYNC_H_
+#define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_ASYNC_H_
+
+#include <stddef.h>
+
+#include "tachyon/c/export.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns the number of asynchronous MSMs which can run at once. It's 1 by
+// default, since each MSM already uses every core.
+TACHYON_C_EXPORT size_t tachyon_msm_async_get_max_concurrency();
+
+// |max_concurrency| should be positive.
+TACHYON_C_EXPORT void tachyon_msm_async_set_max_concurrency(
+    size_t max_concurrency);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_ASYNC_H_
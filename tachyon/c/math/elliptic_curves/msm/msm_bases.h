@@ -0,0 +1,56 @@
+#ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_BASES_H_
+#define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_BASES_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/cc/math/elliptic_curves/point_traits.h"
+#include "tachyon/math/geometry/point2.h"
+
+namespace tachyon::c::math {
+
+// MSMBases holds bases converted into |AffinePointTy| once, so that the MSMs
+// which share the bases, e.g., the commitments over the same SRS, don't copy
+// and convert them on every call like |MSMInputProvider| does.
+template <typename AffinePointTy>
+class MSMBases {
+ public:
+  using BaseField = typename AffinePointTy::BaseField;
+  using CCurvePointTy =
+      typename tachyon::cc::math::PointTraits<AffinePointTy>::CCurvePointTy;
+  using CPointTy =
+      typename tachyon::cc::math::PointTraits<AffinePointTy>::CPointTy;
+
+  // A point whose x and y are both zero is regarded as the point at infinity.
+  MSMBases(const CPointTy* bases_in, size_t size) : bases_(size) {
+    const tachyon::math::Point2<BaseField>* points =
+        reinterpret_cast<const tachyon::math::Point2<BaseField>*>(bases_in);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      bases_[i] = AffinePointTy(points[i],
+                                points[i].x.IsZero() && points[i].y.IsZero());
+    }
+  }
+  MSMBases(const CCurvePointTy* bases_in, size_t size)
+      : bases_(reinterpret_cast<const AffinePointTy*>(bases_in),
+               reinterpret_cast<const AffinePointTy*>(bases_in) + size) {}
+  MSMBases(const MSMBases& other) = delete;
+  MSMBases& operator=(const MSMBases& other) = delete;
+
+  size_t size() const { return bases_.size(); }
+
+  // Returns the first |size| bases.
+  absl::Span<const AffinePointTy> bases(size_t size) const {
+    return absl::MakeConstSpan(bases_).subspan(0, size);
+  }
+
+ private:
+  std::vector<AffinePointTy> bases_;
+};
+
+}  // namespace tachyon::c::math
+
+#endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_BASES_H_
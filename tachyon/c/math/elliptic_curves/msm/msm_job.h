@@ -0,0 +1,136 @@
+#ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_JOB_H_
+#define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_JOB_H_
+
+#include <stddef.h>
+
+#include <functional>
+#include <utility>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_bases.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_input_provider.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_worker_pool.h"
+#include "tachyon/cc/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::c::math {
+
+// MSMJob runs an MSM on |MSMWorkerPool|. Each job has its own MSM, so that
+// the jobs don't share any state and can run at the same time. The inputs
+// are read on the worker, so that they should outlive the job, or at least
+// until |IsDone()| returns true.
+template <typename PointTy>
+class MSMJob {
+ public:
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename tachyon::math::VariableBaseMSM<PointTy>::Bucket;
+
+  MSMJob() = default;
+  MSMJob(const MSMJob& other) = delete;
+  MSMJob& operator=(const MSMJob& other) = delete;
+  // Waits until the job, including |on_done| given to |Start()|, finishes.
+  ~MSMJob() {
+    absl::MutexLock lock(&mu_);
+    mu_.Await(absl::Condition(&finished_));
+  }
+
+  // Posts the MSM to |MSMWorkerPool|. |on_done| is called on the worker after
+  // the result is ready if it's not null. It must not destroy the job. A job
+  // should be started only once.
+  template <typename CPointTy, typename CScalarField>
+  void Start(const CPointTy* bases, const CScalarField* scalars, size_t size,
+             std::function<void()> on_done) {
+    MarkStarted();
+    MSMWorkerPool::GetInstance().PostTask(
+        [this, bases, scalars, size, on_done = std::move(on_done)]() {
+          MSMInputProvider<PointTy> provider;
+          provider.Inject(bases, scalars, size);
+          Finish(provider.bases(), provider.scalars(), on_done);
+        });
+  }
+
+  template <typename CScalarField>
+  void Start(const MSMBases<PointTy>& bases, const CScalarField* scalars,
+             size_t size, std::function<void()> on_done) {
+    CHECK_LE(size, bases.size());
+    MarkStarted();
+    MSMWorkerPool::GetInstance().PostTask(
+        [this, &bases, scalars, size, on_done = std::move(on_done)]() {
+          Finish(bases.bases(size),
+                 absl::MakeConstSpan(
+                     reinterpret_cast<const ScalarField*>(scalars), size),
+                 on_done);
+        });
+  }
+
+  bool IsDone() const {
+    absl::MutexLock lock(&mu_);
+    return done_;
+  }
+
+  // Blocks until the result is ready.
+  const Bucket& Wait() const {
+    absl::MutexLock lock(&mu_);
+    mu_.Await(absl::Condition(&done_));
+    return result_;
+  }
+
+ private:
+  void MarkStarted() {
+    absl::MutexLock lock(&mu_);
+    finished_ = false;
+  }
+
+  void Finish(absl::Span<const PointTy> bases,
+              absl::Span<const ScalarField> scalars,
+              const std::function<void()>& on_done) {
+    Bucket result;
+    CHECK(msm_.Run(bases, scalars, &result));
+    {
+      absl::MutexLock lock(&mu_);
+      result_ = result;
+      done_ = true;
+    }
+    if (on_done) on_done();
+    absl::MutexLock lock(&mu_);
+    finished_ = true;
+  }
+
+  tachyon::math::VariableBaseMSM<PointTy> msm_;
+  mutable absl::Mutex mu_;
+  Bucket result_ ABSL_GUARDED_BY(mu_);
+  bool done_ ABSL_GUARDED_BY(mu_) = false;
+  // It's true until the job starts, so that a job which never started can be
+  // destroyed.
+  bool finished_ ABSL_GUARDED_BY(mu_) = true;
+};
+
+// Returns a closure which calls |callback| with |job| and |user_data|, or
+// null if |callback| is null.
+template <typename Callback, typename CJob>
+std::function<void()> BindMSMJobCallback(Callback callback, CJob* job,
+                                         void* user_data) {
+  if (!callback) return nullptr;
+  return [callback, job, user_data]() { callback(job, user_data); };
+}
+
+// Waits for |job| and returns its result in a newly allocated C point.
+template <
+    typename RetPointTy, typename PointTy,
+    typename CRetPointTy =
+        typename cc::math::PointTraits<RetPointTy>::CCurvePointTy>
+CRetPointTy* WaitMSMJob(const MSMJob<PointTy>& job) {
+  auto ret = tachyon::math::ConvertPoint<RetPointTy>(job.Wait());
+  CRetPointTy* cret = new CRetPointTy();
+  cc::math::ToCPoint3(ret, cret);
+  return cret;
+}
+
+}  // namespace tachyon::c::math
+
+#endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_JOB_H_
@@ -0,0 +1,9 @@
+#ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_STATS_H_
+#define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_STATS_H_
+
+// The stats which an MSM collects when built with TACHYON_HAS_MSM_STATS. It is
+// opaque in C, while in C++ it is a |tachyon::math::MSMStats|. See
+// tachyon/c/math/elliptic_curves/msm/msm.h.
+typedef struct tachyon_msm_stats tachyon_msm_stats;
+
+#endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_STATS_H_
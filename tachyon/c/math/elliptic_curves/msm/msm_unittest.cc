@@ -1,10 +1,12 @@
 #include "tachyon/c/math/elliptic_curves/bn/bn254/msm.h"
 
+#include "absl/synchronization/mutex.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/base/bits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/fq_prime_field_traits.h"
 #include "tachyon/c/math/elliptic_curves/bn/bn254/g1_point_traits.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm.h"
 #include "tachyon/cc/math/elliptic_curves/point_conversions.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
 
@@ -35,6 +37,13 @@ class MSMTest : public testing::Test {
 tachyon_bn254_g1_msm_ptr MSMTest::msm_;
 std::vector<MSMTestSet<bn254::G1AffinePoint>> MSMTest::test_sets_;
 
+TEST_F(MSMTest, GetStats) {
+  // In C++, the stats can be read as |MSMStats|.
+  const MSMStats* stats = tachyon_bn254_g1_msm_get_stats(msm_);
+  ASSERT_NE(stats, nullptr);
+  EXPECT_EQ(tachyon_bn254_g1_msm_get_stats(msm_), stats);
+}
+
 TEST_F(MSMTest, MSMPoint2) {
   for (const MSMTestSet<bn254::G1AffinePoint>& t : test_sets_) {
     std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
@@ -59,4 +68,104 @@ TEST_F(MSMTest, MSMG1Affine) {
   }
 }
 
+TEST_F(MSMTest, MSMWithBases) {
+  const MSMTestSet<bn254::G1AffinePoint>& largest = test_sets_[0];
+  std::vector<Point2<BigInt<4>>> points =
+      base::CreateVector(largest.bases.size(), [&largest](size_t i) {
+        return largest.bases[i].ToMontgomery();
+      });
+  tachyon_bn254_g1_msm_bases_ptr bases_list[] = {
+      tachyon_bn254_g1_create_msm_bases_from_point2(
+          reinterpret_cast<const tachyon_bn254_g1_point2*>(points.data()),
+          points.size()),
+      tachyon_bn254_g1_create_msm_bases_from_affine(
+          reinterpret_cast<const tachyon_bn254_g1_affine*>(
+              largest.bases.data()),
+          largest.bases.size()),
+  };
+
+  for (tachyon_bn254_g1_msm_bases_ptr bases : bases_list) {
+    for (const MSMTestSet<bn254::G1AffinePoint>& t : test_sets_) {
+      // The scalars go with a prefix of the registered bases.
+      bn254::G1JacobianPoint expected = bn254::G1JacobianPoint::Zero();
+      for (size_t i = 0; i < t.scalars.size(); ++i) {
+        expected += largest.bases[i].ScalarMul(t.scalars[i].ToBigInt());
+      }
+      std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+      ret.reset(tachyon_bn254_g1_msm_with_bases(
+          msm_, bases,
+          reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+          t.scalars.size()));
+      EXPECT_EQ(cc::math::ToJacobianPoint(*ret), expected);
+    }
+    tachyon_bn254_g1_destroy_msm_bases(bases);
+  }
+}
+
+TEST_F(MSMTest, MSMAsync) {
+  std::vector<tachyon_bn254_g1_msm_job_ptr> jobs;
+  std::vector<std::vector<Point2<BigInt<4>>>> points_list;
+  for (const MSMTestSet<bn254::G1AffinePoint>& t : test_sets_) {
+    points_list.push_back(base::CreateVector(
+        t.bases.size(), [&t](size_t i) { return t.bases[i].ToMontgomery(); }));
+  }
+  // The jobs of all the test sets are in flight at once.
+  for (size_t i = 0; i < test_sets_.size(); ++i) {
+    const MSMTestSet<bn254::G1AffinePoint>& t = test_sets_[i];
+    jobs.push_back(tachyon_bn254_g1_point2_msm_async(
+        reinterpret_cast<const tachyon_bn254_g1_point2*>(
+            points_list[i].data()),
+        reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+        t.scalars.size(), nullptr, nullptr));
+    jobs.push_back(tachyon_bn254_g1_affine_msm_async(
+        reinterpret_cast<const tachyon_bn254_g1_affine*>(t.bases.data()),
+        reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+        t.scalars.size(), nullptr, nullptr));
+  }
+  for (size_t i = 0; i < jobs.size(); ++i) {
+    std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+    ret.reset(tachyon_bn254_g1_msm_job_wait(jobs[i]));
+    EXPECT_TRUE(tachyon_bn254_g1_msm_job_poll(jobs[i]));
+    EXPECT_EQ(cc::math::ToJacobianPoint(*ret),
+              test_sets_[i / 2].answer.ToJacobian());
+    tachyon_bn254_g1_destroy_msm_job(jobs[i]);
+  }
+}
+
+TEST_F(MSMTest, MSMWithBasesAsync) {
+  const MSMTestSet<bn254::G1AffinePoint>& t = test_sets_[0];
+  tachyon_bn254_g1_msm_bases_ptr bases =
+      tachyon_bn254_g1_create_msm_bases_from_affine(
+          reinterpret_cast<const tachyon_bn254_g1_affine*>(t.bases.data()),
+          t.bases.size());
+
+  struct Done {
+    absl::Mutex mu;
+    tachyon_bn254_g1_msm_job_ptr job = nullptr;
+  } done;
+  tachyon_bn254_g1_msm_job_ptr job = tachyon_bn254_g1_msm_with_bases_async(
+      bases, reinterpret_cast<const tachyon_bn254_fr*>(t.scalars.data()),
+      t.scalars.size(),
+      [](tachyon_bn254_g1_msm_job_ptr job, void* user_data) {
+        Done* done = reinterpret_cast<Done*>(user_data);
+        absl::MutexLock lock(&done->mu);
+        done->job = job;
+      },
+      &done);
+  {
+    absl::MutexLock lock(&done.mu);
+    done.mu.Await(absl::Condition(
+        +[](tachyon_bn254_g1_msm_job_ptr* job) { return *job != nullptr; },
+        &done.job));
+    EXPECT_EQ(done.job, job);
+  }
+  EXPECT_TRUE(tachyon_bn254_g1_msm_job_poll(job));
+  std::unique_ptr<tachyon_bn254_g1_jacobian> ret;
+  ret.reset(tachyon_bn254_g1_msm_job_wait(job));
+  EXPECT_EQ(cc::math::ToJacobianPoint(*ret), t.answer.ToJacobian());
+
+  tachyon_bn254_g1_destroy_msm_job(job);
+  tachyon_bn254_g1_destroy_msm_bases(bases);
+}
+
 }  // namespace tachyon::math
@@ -0,0 +1,56 @@
+#include "tachyon/c/math/elliptic_curves/msm/msm_worker_pool.h"
+
+#include <thread>
+#include <utility>
+
+#include "tachyon/base/logging.h"
+
+namespace tachyon::c::math {
+
+// static
+MSMWorkerPool& MSMWorkerPool::GetInstance() {
+  static base::NoDestructor<MSMWorkerPool> pool;
+  return *pool;
+}
+
+size_t MSMWorkerPool::GetMaxConcurrency() const {
+  absl::MutexLock lock(&mu_);
+  return max_concurrency_;
+}
+
+void MSMWorkerPool::SetMaxConcurrency(size_t max_concurrency) {
+  CHECK_GT(max_concurrency, size_t{0});
+  absl::MutexLock lock(&mu_);
+  max_concurrency_ = max_concurrency;
+}
+
+void MSMWorkerPool::PostTask(std::function<void()> task) {
+  absl::MutexLock lock(&mu_);
+  tasks_.push_back(std::move(task));
+  // A thread blocks until it can run a task, so that the pool needs as many
+  // threads as the tasks which can run at once.
+  if (thread_nums_ < max_concurrency_) {
+    ++thread_nums_;
+    std::thread(&MSMWorkerPool::RunWorker, this).detach();
+  }
+}
+
+void MSMWorkerPool::RunWorker() {
+  while (true) {
+    std::function<void()> task;
+    {
+      absl::MutexLock lock(&mu_);
+      mu_.Await(absl::Condition(this, &MSMWorkerPool::CanRunTask));
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+      ++running_task_nums_;
+    }
+    task();
+    {
+      absl::MutexLock lock(&mu_);
+      --running_task_nums_;
+    }
+  }
+}
+
+}  // namespace tachyon::c::math
@@ -0,0 +1,57 @@
+#ifndef TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_WORKER_POOL_H_
+#define TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_WORKER_POOL_H_
+
+#include <stddef.h>
+
+#include <deque>
+#include <functional>
+
+#include "absl/base/thread_annotations.h"
+#include "absl/synchronization/mutex.h"
+
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/export.h"
+
+namespace tachyon::c::math {
+
+// MSMWorkerPool runs the asynchronous MSMs on its own threads, at most
+// |max_concurrency()| of them at once. Each MSM already spreads over every
+// core with OpenMP, so that it runs one at a time by default. The threads are
+// spawned on demand and live until the process exits.
+class TACHYON_EXPORT MSMWorkerPool {
+ public:
+  constexpr static size_t kDefaultMaxConcurrency = 1;
+
+  static MSMWorkerPool& GetInstance();
+
+  MSMWorkerPool(const MSMWorkerPool& other) = delete;
+  MSMWorkerPool& operator=(const MSMWorkerPool& other) = delete;
+
+  size_t GetMaxConcurrency() const;
+  // |max_concurrency| should be positive. The tasks already running keep
+  // running when it's lowered.
+  void SetMaxConcurrency(size_t max_concurrency);
+
+  void PostTask(std::function<void()> task);
+
+ private:
+  friend class base::NoDestructor<MSMWorkerPool>;
+
+  MSMWorkerPool() = default;
+
+  bool CanRunTask() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(mu_) {
+    return !tasks_.empty() && running_task_nums_ < max_concurrency_;
+  }
+
+  void RunWorker();
+
+  mutable absl::Mutex mu_;
+  size_t max_concurrency_ ABSL_GUARDED_BY(mu_) = kDefaultMaxConcurrency;
+  size_t thread_nums_ ABSL_GUARDED_BY(mu_) = 0;
+  size_t running_task_nums_ ABSL_GUARDED_BY(mu_) = 0;
+  std::deque<std::function<void()>> tasks_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace tachyon::c::math
+
+#endif  // TACHYON_C_MATH_ELLIPTIC_CURVES_MSM_MSM_WORKER_POOL_H_
@@ -0,0 +1,46 @@
+#include "tachyon/c/math/elliptic_curves/msm/msm_worker_pool.h"
+
+#include <algorithm>
+
+#include "absl/synchronization/mutex.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/c/math/elliptic_curves/msm/msm_async.h"
+
+namespace tachyon::c::math {
+
+TEST(MSMWorkerPoolTest, MaxConcurrency) {
+  MSMWorkerPool& pool = MSMWorkerPool::GetInstance();
+  size_t max_concurrency = pool.GetMaxConcurrency();
+
+  tachyon_msm_async_set_max_concurrency(2);
+  EXPECT_EQ(tachyon_msm_async_get_max_concurrency(), 2);
+
+  constexpr size_t kTaskNums = 8;
+  absl::Mutex mu;
+  size_t running = 0;
+  size_t max_running = 0;
+  size_t finished = 0;
+  for (size_t i = 0; i < kTaskNums; ++i) {
+    pool.PostTask([&]() {
+      {
+        absl::MutexLock lock(&mu);
+        max_running = std::max(max_running, ++running);
+      }
+      // Gives the other tasks a chance to run at the same time.
+      absl::SleepFor(absl::Milliseconds(5));
+      absl::MutexLock lock(&mu);
+      --running;
+      ++finished;
+    });
+  }
+
+  absl::MutexLock lock(&mu);
+  mu.Await(absl::Condition(
+      +[](size_t* finished) { return *finished == kTaskNums; }, &finished));
+  EXPECT_LE(max_running, 2);
+
+  pool.SetMaxConcurrency(max_concurrency);
+}
+
+}  // namespace tachyon::c::math
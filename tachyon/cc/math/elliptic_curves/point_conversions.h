@@ -2,6 +2,7 @@
 #define TACHYON_CC_MATH_ELLIPTIC_CURVES_POINT_CONVERSIONS_H_
 
 #include <stddef.h>
+#include <string.h>
 
 #include <type_traits>
 
@@ -90,91 +91,82 @@ PointTy ToPoint4(const CPointTy& point_in) {
   return point;
 }
 
+namespace internal {
+
+// Copies |f| in Montgomery form into |f_out|. The C type of an extension field
+// lays out its coefficients in the same way, e.g., |tachyon_bn254_fq2|.
+template <typename Field, typename CField>
+void CopyToCField(const Field& f, CField* f_out) {
+  if constexpr (Field::ExtensionDegree() == 1) {
+    memcpy(f_out->limbs, f.value().limbs, sizeof(uint64_t) * Field::kLimbNums);
+  } else {
+    static_assert(sizeof(CField) == sizeof(Field));
+    memcpy(f_out, &f, sizeof(Field));
+  }
+}
+
+}  // namespace internal
+
 template <typename PointTy,
-          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy,
-          typename BaseField = typename PointTy::BaseField,
-          size_t LimbNumbs = BaseField::kLimbNums>
+          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy>
 CPointTy ToCAffinePoint(const PointTy& point_in) {
   CPointTy ret;
-  memcpy(ret.x.limbs, point_in.x().value().limbs, sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.y.limbs, point_in.y().value().limbs, sizeof(uint64_t) * LimbNumbs);
+  internal::CopyToCField(point_in.x(), &ret.x);
+  internal::CopyToCField(point_in.y(), &ret.y);
   ret.infinity = point_in.infinity();
   return ret;
 }
 
 template <typename PointTy,
-          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy,
-          typename BaseField = typename PointTy::BaseField,
-          size_t LimbNumbs = BaseField::kLimbNums>
+          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy>
 CPointTy ToCProjectivePoint(const PointTy& point_in) {
   CPointTy ret;
-  memcpy(ret.x.limbs, point_in.x().value().limbs, sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.y.limbs, point_in.y().value().limbs, sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.z.limbs, point_in.z().value().limbs, sizeof(uint64_t) * LimbNumbs);
+  internal::CopyToCField(point_in.x(), &ret.x);
+  internal::CopyToCField(point_in.y(), &ret.y);
+  internal::CopyToCField(point_in.z(), &ret.z);
   return ret;
 }
 
 template <typename PointTy,
-          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy,
-          typename BaseField = typename PointTy::BaseField,
-          size_t LimbNumbs = BaseField::kLimbNums>
+          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy>
 CPointTy ToCJacobianPoint(const PointTy& point_in) {
   CPointTy ret;
-  memcpy(ret.x.limbs, point_in.x().value().limbs, sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.y.limbs, point_in.y().value().limbs, sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.z.limbs, point_in.z().value().limbs, sizeof(uint64_t) * LimbNumbs);
+  internal::CopyToCField(point_in.x(), &ret.x);
+  internal::CopyToCField(point_in.y(), &ret.y);
+  internal::CopyToCField(point_in.z(), &ret.z);
   return ret;
 }
 
 template <typename PointTy,
-          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy,
-          typename BaseField = typename PointTy::BaseField,
-          size_t LimbNumbs = BaseField::kLimbNums>
+          typename CPointTy = typename PointTraits<PointTy>::CCurvePointTy>
 CPointTy ToCPointXYZZ(const PointTy& point_in) {
   CPointTy ret;
-  memcpy(ret.x.limbs, point_in.x().value().limbs, sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.y.limbs, point_in.y().value().limbs, sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.zz.limbs, point_in.zz().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
-  memcpy(ret.zzz.limbs, point_in.zzz().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
+  internal::CopyToCField(point_in.x(), &ret.x);
+  internal::CopyToCField(point_in.y(), &ret.y);
+  internal::CopyToCField(point_in.zz(), &ret.zz);
+  internal::CopyToCField(point_in.zzz(), &ret.zzz);
   return ret;
 }
 
-template <typename PointTy, typename CPointTy,
-          typename BaseField = typename PointTy::BaseField,
-          size_t LimbNumbs = BaseField::kLimbNums>
+template <typename PointTy, typename CPointTy>
 void ToCPoint2(const PointTy& point_in, CPointTy* point_out) {
-  memcpy(point_out->x.limbs, point_in.x().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
-  memcpy(point_out->y.limbs, point_in.y().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
+  internal::CopyToCField(point_in.x(), &point_out->x);
+  internal::CopyToCField(point_in.y(), &point_out->y);
 }
 
-template <typename PointTy, typename CPointTy,
-          typename BaseField = typename PointTy::BaseField,
-          size_t LimbNumbs = BaseField::kLimbNums>
+template <typename PointTy, typename CPointTy>
 void ToCPoint3(const PointTy& point_in, CPointTy* point_out) {
-  memcpy(point_out->x.limbs, point_in.x().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
-  memcpy(point_out->y.limbs, point_in.y().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
-  memcpy(point_out->z.limbs, point_in.z().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
+  internal::CopyToCField(point_in.x(), &point_out->x);
+  internal::CopyToCField(point_in.y(), &point_out->y);
+  internal::CopyToCField(point_in.z(), &point_out->z);
 }
 
-template <typename PointTy, typename CPointTy,
-          typename BaseField = typename PointTy::BaseField,
-          size_t LimbNumbs = BaseField::kLimbNums>
+template <typename PointTy, typename CPointTy>
 void ToCPoint4(const PointTy& point_in, CPointTy* point_out) {
-  memcpy(point_out->x.limbs, point_in.x().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
-  memcpy(point_out->y.limbs, point_in.y().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
-  memcpy(point_out->z.limbs, point_in.z().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
-  memcpy(point_out->w.limbs, point_in.w().value().limbs,
-         sizeof(uint64_t) * LimbNumbs);
+  internal::CopyToCField(point_in.x(), &point_out->x);
+  internal::CopyToCField(point_in.y(), &point_out->y);
+  internal::CopyToCField(point_in.z(), &point_out->z);
+  internal::CopyToCField(point_in.w(), &point_out->w);
 }
 
 }  // namespace tachyon::cc::math
@@ -11,7 +11,10 @@
 #include <utility>
 #include <vector>
 
+#include "absl/types/span.h"
+
 #include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
 
@@ -41,10 +44,23 @@ class PedersenParams {
 
   void set_generators(const std::vector<PointTy>& generators) {
     generators_ = generators;
+    fixed_base_msm_ = math::FixedBaseMSM<PointTy>();
   }
 
   void set_generators(std::vector<PointTy>&& generators) {
     generators_ = std::move(generators);
+    fixed_base_msm_ = math::FixedBaseMSM<PointTy>();
+  }
+
+  bool is_precomputed() const { return fixed_base_msm_.size() > 0; }
+
+  // Precomputes tables of |generators_| within |memory_budget| bytes, after
+  // which |Commit()| is done by |math::FixedBaseMSM|. This pays off when the
+  // same params commit many times.
+  bool Precompute(size_t memory_budget =
+                      math::FixedBaseMSM<PointTy>::kDefaultMemoryBudget) {
+    return fixed_base_msm_.PrecomputeWithMemoryBudget(generators_,
+                                                      memory_budget);
   }
 
   static PedersenParams Random(size_t max_size) {
@@ -68,9 +84,46 @@ class PedersenParams {
   template <typename R>
   bool Commit(const std::vector<ScalarField>& v, const ScalarField& r,
               R* out) const {
-    math::VariableBaseMSM<PointTy> msm;
     Bucket generator_msm_v;
-    if (!msm.Run(generators_, v, &generator_msm_v)) return false;
+    if (is_precomputed()) {
+      if (!fixed_base_msm_.Run(v, &generator_msm_v)) return false;
+    } else {
+      math::VariableBaseMSM<PointTy> msm;
+      if (!msm.Run(generators_, v, &generator_msm_v)) return false;
+    }
+
+    *out = r * h_ + math::ConvertPoint<R>(generator_msm_v);
+    return true;
+  }
+
+  // Updates |prev|, the commitment to the values before the ones at |indices|
+  // changed from |old_v| to the ones in |v| and with the blinding factor
+  // |old_r|, into the commitment to |v| with |r|. See
+  // |math::VariableBaseMSM::RunDelta()|. When it recomputes the commitment
+  // from scratch, the precomputed tables are used if any. The arguments are
+  // checked before a path is chosen.
+  template <typename R>
+  bool CommitDelta(const std::vector<ScalarField>& v,
+                   absl::Span<const size_t> indices,
+                   absl::Span<const ScalarField> old_v, const ScalarField& r,
+                   const ScalarField& old_r, const R& prev, R* out) const {
+    if (!math::VariableBaseMSM<PointTy>::ValidateDeltaArgs(v.size(), indices,
+                                                           old_v.size())) {
+      return false;
+    }
+    if (is_precomputed() && !math::VariableBaseMSM<PointTy>::ShouldRunDelta(
+                                v.size(), indices.size())) {
+      return Commit(v, r, out);
+    }
+
+    // <|g|, |v|> before the change.
+    Bucket prev_generator_msm_v = math::ConvertPoint<Bucket>(prev - old_r * h_);
+    Bucket generator_msm_v;
+    math::VariableBaseMSM<PointTy> msm;
+    if (!msm.RunDelta(generators_, v, indices, old_v, prev_generator_msm_v,
+                      &generator_msm_v)) {
+      return false;
+    }
 
     *out = r * h_ + math::ConvertPoint<R>(generator_msm_v);
     return true;
@@ -92,6 +145,7 @@ class PedersenParams {
  private:
   PointTy h_;
   std::vector<PointTy> generators_;
+  math::FixedBaseMSM<PointTy> fixed_base_msm_;
 };
 
 };  // namespace tachyon::crypto
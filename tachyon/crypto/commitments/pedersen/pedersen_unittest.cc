@@ -1,5 +1,6 @@
 #include "tachyon/crypto/commitments/pedersen/pedersen.h"
 
+#include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
@@ -35,4 +36,97 @@ TEST_F(PedersenTest, CommitPedersen) {
   EXPECT_EQ(commitment, msm_result + r * params.h());
 }
 
+TEST_F(PedersenTest, CommitPedersenWithPrecomputation) {
+  const size_t max_size = 3;
+
+  PedersenParams<math::bn254::G1JacobianPoint> params =
+      PedersenParams<math::bn254::G1JacobianPoint>::Random(max_size);
+  EXPECT_FALSE(params.is_precomputed());
+
+  std::vector<math::bn254::Fr> v =
+      base::CreateVector(max_size, []() { return math::bn254::Fr::Random(); });
+  math::bn254::Fr r = math::bn254::Fr::Random();
+  math::bn254::G1JacobianPoint expected;
+  ASSERT_TRUE(params.Commit(v, r, &expected));
+
+  ASSERT_TRUE(params.Precompute(/*memory_budget=*/size_t{1} << 20));
+  EXPECT_TRUE(params.is_precomputed());
+  math::bn254::G1JacobianPoint commitment;
+  ASSERT_TRUE(params.Commit(v, r, &commitment));
+  EXPECT_EQ(commitment, expected);
+
+  params.set_generators(params.generators());
+  EXPECT_FALSE(params.is_precomputed());
+}
+
+TEST_F(PedersenTest, CommitDelta) {
+  const size_t max_size = 40;
+
+  PedersenParams<math::bn254::G1JacobianPoint> params =
+      PedersenParams<math::bn254::G1JacobianPoint>::Random(max_size);
+
+  std::vector<math::bn254::Fr> v =
+      base::CreateVector(max_size, []() { return math::bn254::Fr::Random(); });
+  math::bn254::Fr old_r = math::bn254::Fr::Random();
+  math::bn254::G1JacobianPoint prev;
+  ASSERT_TRUE(params.Commit(v, old_r, &prev));
+
+  std::vector<size_t> indices = {1, 5, 30};
+  std::vector<math::bn254::Fr> old_v;
+  for (size_t index : indices) {
+    old_v.push_back(v[index]);
+    v[index] = math::bn254::Fr::Random();
+  }
+  math::bn254::Fr r = math::bn254::Fr::Random();
+  math::bn254::G1JacobianPoint expected;
+  ASSERT_TRUE(params.Commit(v, r, &expected));
+
+  for (bool precompute : {false, true}) {
+    if (precompute) {
+      ASSERT_TRUE(params.Precompute(/*memory_budget=*/size_t{1} << 20));
+    }
+    math::bn254::G1JacobianPoint commitment;
+    ASSERT_TRUE(
+        params.CommitDelta(v, indices, old_v, r, old_r, prev, &commitment));
+    EXPECT_EQ(commitment, expected);
+  }
+}
+
+TEST_F(PedersenTest, CommitDeltaWithInvalidInputs) {
+  const size_t max_size = 40;
+
+  PedersenParams<math::bn254::G1JacobianPoint> params =
+      PedersenParams<math::bn254::G1JacobianPoint>::Random(max_size);
+
+  std::vector<math::bn254::Fr> v =
+      base::CreateVector(max_size, []() { return math::bn254::Fr::Random(); });
+  math::bn254::Fr r = math::bn254::Fr::Random();
+  math::bn254::G1JacobianPoint prev;
+  ASSERT_TRUE(params.Commit(v, r, &prev));
+
+  // Every index changes, so that the precomputed params recompute the
+  // commitment from scratch. The same input must be rejected either way.
+  std::vector<size_t> indices =
+      base::CreateVector(max_size, [](size_t i) { return i; });
+  std::vector<math::bn254::Fr> old_v = v;
+  absl::Span<const math::bn254::Fr> short_old_v =
+      absl::MakeConstSpan(old_v).subspan(1);
+  for (bool precompute : {false, true}) {
+    SCOPED_TRACE(absl::Substitute("precompute: $0", precompute));
+    if (precompute) {
+      ASSERT_TRUE(params.Precompute(/*memory_budget=*/size_t{1} << 20));
+    }
+    math::bn254::G1JacobianPoint commitment;
+    EXPECT_FALSE(
+        params.CommitDelta(v, indices, short_old_v, r, r, prev, &commitment));
+    indices.back() = max_size;
+    EXPECT_FALSE(
+        params.CommitDelta(v, indices, old_v, r, r, prev, &commitment));
+    indices.back() = 0;
+    EXPECT_FALSE(
+        params.CommitDelta(v, indices, old_v, r, r, prev, &commitment));
+    indices.back() = max_size - 1;
+  }
+}
+
 }  // namespace tachyon::crypto
@@ -14,6 +14,7 @@
 #include "tachyon/crypto/hashes/prime_field_serializable.h"
 #include "tachyon/crypto/hashes/sponge/poseidon/poseidon_config.h"
 #include "tachyon/crypto/hashes/sponge/sponge.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 
 namespace tachyon::crypto {
 
@@ -68,8 +69,18 @@ struct PoseidonSponge
   void ApplySBox(bool is_full_round) {
     if (is_full_round) {
       // Full rounds apply the S-Box (xᵅ) to every element of |state|.
-      for (F& elem : state.elements) {
-        elem = elem.Pow(math::BigInt<1>(config.alpha));
+      math::BigInt<1> alpha(config.alpha);
+      F* elements = state.elements.data();
+      size_t size = state.size();
+      size_t i = 0;
+      using Packed = math::PackedPrimeField<F>;
+      if constexpr (Packed::kIsVectorized) {
+        for (; i + Packed::kLanes <= size; i += Packed::kLanes) {
+          Packed::Load(&elements[i]).Pow(alpha).Store(&elements[i]);
+        }
+      }
+      for (; i < size; ++i) {
+        elements[i] = elements[i].Pow(alpha);
       }
     } else {
       // Partial rounds apply the S-Box (xᵅ) to just the first element of
@@ -82,7 +93,15 @@ struct PoseidonSponge
     state.elements += config.ark.row(round_number);
   }
 
-  void ApplyMDS() { state.elements = config.mds * state.elements; }
+  // Each row goes through |F::SumOfProducts()|, which reduces the products
+  // of a row at once for a |math::PrimeField|.
+  void ApplyMDS() {
+    math::Vector<F> elements(state.elements.size());
+    for (Eigen::Index i = 0; i < elements.size(); ++i) {
+      elements[i] = F::SumOfProducts(config.mds.row(i), state.elements);
+    }
+    state.elements = std::move(elements);
+  }
 
   void Permute() {
     size_t full_rounds_over_2 = config.full_rounds / 2;
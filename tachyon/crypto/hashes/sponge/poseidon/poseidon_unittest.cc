@@ -41,4 +41,23 @@ TEST_F(PoseidonTest, AbsorbSqueeze) {
   EXPECT_EQ(result, expected);
 }
 
+TEST_F(PoseidonTest, ApplySBox) {
+  using Fr = math::bls12_381::Fr;
+
+  // The |state| is wide enough for the S-Box to run on |PackedPrimeField|.
+  PoseidonConfig<Fr> config = PoseidonConfig<Fr>::CreateDefault(8, false);
+  PoseidonSponge<Fr> sponge(config);
+  for (size_t i = 0; i < sponge.state.size(); ++i) {
+    sponge.state[i] = Fr::Random();
+  }
+  PoseidonSponge<Fr>::State expected = sponge.state;
+  for (size_t i = 0; i < expected.size(); ++i) {
+    expected[i] = expected[i].Pow(math::BigInt<1>(config.alpha));
+  }
+  sponge.ApplySBox(true);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(sponge.state[i], expected[i]);
+  }
+}
+
 }  // namespace tachyon::crypto
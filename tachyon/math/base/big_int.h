@@ -829,6 +829,43 @@ struct ALIGNAS(internal::LimbsAlignment(N)) BigInt {
     return ret;
   }
 
+  // This converts bigint to w-NAF(width-w Non-Adjacent-Form), whose nonzero
+  // digits are odd and lie in (-2ʷ⁻¹, 2ʷ⁻¹), and any w consecutive digits have
+  // at most one nonzero digit. |ToNAF()| is the same as |ToWNAF(2)|.
+  // e.g, 7 = (1 1 1)₂ = (1 0 0 -1)₂ when w = 2 and (7)₂ when w = 4.
+  // |window_bits| must be in [2, 8].
+  // See https://en.wikipedia.org/wiki/Elliptic_curve_point_multiplication
+  std::vector<int8_t> ToWNAF(size_t window_bits) const {
+    DCHECK_GE(window_bits, size_t{2});
+    DCHECK_LE(window_bits, size_t{8});
+    const uint64_t window_length = uint64_t{1} << window_bits;
+    const uint64_t mask = window_length - 1;
+    BigInt v(*this);
+    std::vector<int8_t> ret;
+    ret.reserve(8 * sizeof(uint64_t) * N + 1);
+    while (!v.IsZero()) {
+      int8_t z;
+      if (v.IsOdd()) {
+        // z = v mod 2ʷ taken in (-2ʷ⁻¹, 2ʷ⁻¹), which makes the next w - 1
+        // digits zero after v -= z.
+        uint64_t rem = v[kSmallestLimbIdx] & mask;
+        if (rem >= (window_length >> 1)) {
+          z = static_cast<int8_t>(static_cast<int64_t>(rem) -
+                                  static_cast<int64_t>(window_length));
+          v += BigInt(static_cast<uint64_t>(-z));
+        } else {
+          z = static_cast<int8_t>(rem);
+          v -= BigInt(rem);
+        }
+      } else {
+        z = 0;
+      }
+      ret.push_back(z);
+      v.DivBy2InPlace();
+    }
+    return ret;
+  }
+
  private:
   template <typename T>
   constexpr T ExtractBits(size_t bit_offset, size_t bit_count) const {
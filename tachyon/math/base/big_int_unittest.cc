@@ -1,5 +1,7 @@
 #include "tachyon/math/base/big_int.h"
 
+#include <stdlib.h>
+
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -121,6 +123,41 @@ TEST(BigIntTest, ExtractBits) {
   }
 }
 
+TEST(BigIntTest, ToWNAF) {
+  BigInt<2> big_int = BigInt<2>::Random();
+  EXPECT_EQ(big_int.ToWNAF(2), big_int.ToNAF());
+  EXPECT_EQ(BigInt<2>(7).ToWNAF(4), std::vector<int8_t>({7}));
+  EXPECT_EQ(BigInt<2>(15).ToWNAF(4), std::vector<int8_t>({-1, 0, 0, 0, 1}));
+
+  // Random() is shifted down to leave room for the carries.
+  big_int.DivBy2ExpInPlace(8);
+  for (size_t window_bits = 2; window_bits <= 8; ++window_bits) {
+    SCOPED_TRACE(window_bits);
+    std::vector<int8_t> digits = big_int.ToWNAF(window_bits);
+    BigInt<2> value = BigInt<2>::Zero();
+    size_t last_nonzero = 0;
+    bool has_nonzero = false;
+    for (size_t i = digits.size(); i-- > 0;) {
+      value.MulBy2InPlace();
+      int8_t digit = digits[i];
+      if (digit == 0) continue;
+      EXPECT_NE(digit % 2, 0);
+      EXPECT_LT(std::abs(digit), 1 << (window_bits - 1));
+      if (has_nonzero) {
+        EXPECT_GE(last_nonzero - i, window_bits);
+      }
+      has_nonzero = true;
+      last_nonzero = i;
+      if (digit > 0) {
+        value += BigInt<2>(digit);
+      } else {
+        value -= BigInt<2>(-digit);
+      }
+    }
+    EXPECT_EQ(value, big_int);
+  }
+}
+
 TEST(BigIntTest, Operations) {
   BigInt<2> big_int =
       BigInt<2>::FromDecString("123456789012345678909876543211235312");
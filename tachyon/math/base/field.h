@@ -28,19 +28,20 @@ template <typename F>
 class Field : public AdditiveGroup<F>, public MultiplicativeGroup<F> {
  public:
   // Sum of products: a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ
-  template <
-      typename InputIterator,
-      std::enable_if_t<std::is_same_v<F, base::iter_value_t<InputIterator>>>* =
-          nullptr>
+  template <typename InputIterator, typename InputIterator2,
+            std::enable_if_t<
+                std::is_same_v<F, base::iter_value_t<InputIterator>> &&
+                std::is_same_v<F, base::iter_value_t<InputIterator2>>>* =
+                nullptr>
   constexpr static F SumOfProducts(InputIterator a_first, InputIterator a_last,
-                                   InputIterator b_first,
-                                   InputIterator b_last) {
+                                   InputIterator2 b_first,
+                                   InputIterator2 b_last) {
     return Ring<F>::SumOfProducts(std::move(a_first), std::move(a_last),
                                   std::move(b_first), std::move(b_last));
   }
 
-  template <typename Container>
-  constexpr static F SumOfProducts(const Container& a, const Container& b) {
+  template <typename Container, typename Container2>
+  constexpr static F SumOfProducts(const Container& a, const Container2& b) {
     return Ring<F>::SumOfProducts(a, b);
   }
 
@@ -50,6 +51,17 @@ class Field : public AdditiveGroup<F>, public MultiplicativeGroup<F> {
     return BatchInverse(fields, &fields, coeff);
   }
 
+  // Same as |BatchInverseInPlace()|, but it never splits the work across
+  // threads. This is useful when it is called from a region which is already
+  // parallelized, where the split just multiplies the number of inversions.
+  template <typename Container>
+  constexpr static bool BatchInverseInPlaceSerial(Container& fields,
+                                                  const F& coeff = F::One()) {
+    if (std::size(fields) == 0) return true;
+    DoBatchInverse(absl::MakeConstSpan(fields), absl::MakeSpan(fields), coeff);
+    return true;
+  }
+
   // This is taken and modified from
   // https://github.com/arkworks-rs/algebra/blob/5dfeedf560da6937a5de0a2163b7958bd32cd551/ff/src/fields/mod.rs#L355-L418.
   // Batch inverse: [b₁, b₂, ..., bₙ] = [a₁⁻¹, a₂⁻¹, ... , aₙ⁻¹]
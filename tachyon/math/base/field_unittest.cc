@@ -26,8 +26,12 @@ TEST(FieldTest, BatchInverse) {
     }
   }
 
+  std::vector<GF7> fields_serial = fields;
   ASSERT_TRUE(GF7::BatchInverseInPlace(fields));
   EXPECT_EQ(fields, inverses);
+
+  ASSERT_TRUE(GF7::BatchInverseInPlaceSerial(fields_serial));
+  EXPECT_EQ(fields_serial, inverses);
 }
 
 }  // namespace tachyon::math
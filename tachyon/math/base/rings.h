@@ -25,13 +25,14 @@ class Ring : public AdditiveGroup<F>, public MultiplicativeSemigroup<F> {
   // This is taken and modified from
   // https://github.com/arkworks-rs/algebra/blob/5dfeedf560da6937a5de0a2163b7958bd32cd551/ff/src/fields/mod.rs#L298C1-L305
   // Sum of products: a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ
-  template <
-      typename InputIterator,
-      std::enable_if_t<std::is_same_v<F, base::iter_value_t<InputIterator>>>* =
-          nullptr>
+  template <typename InputIterator, typename InputIterator2,
+            std::enable_if_t<
+                std::is_same_v<F, base::iter_value_t<InputIterator>> &&
+                std::is_same_v<F, base::iter_value_t<InputIterator2>>>* =
+                nullptr>
   constexpr static F SumOfProducts(InputIterator a_first, InputIterator a_last,
-                                   InputIterator b_first,
-                                   InputIterator b_last) {
+                                   InputIterator2 b_first,
+                                   InputIterator2 b_last) {
     F sum = F::Zero();
     while (a_first != a_last) {
       sum += (*a_first * *b_first);
@@ -41,8 +42,8 @@ class Ring : public AdditiveGroup<F>, public MultiplicativeSemigroup<F> {
     return sum;
   }
 
-  template <typename Container>
-  constexpr static F SumOfProducts(const Container& a, const Container& b) {
+  template <typename Container, typename Container2>
+  constexpr static F SumOfProducts(const Container& a, const Container2& b) {
     return SumOfProducts(std::begin(a), std::end(a), std::begin(b),
                          std::end(b));
   }
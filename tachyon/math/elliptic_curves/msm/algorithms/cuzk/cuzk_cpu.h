@@ -0,0 +1,214 @@
+// Copyright cuZK authors.
+// Use of this source code is governed by a MIT/Apache-2.0 style license that
+// can be found in the LICENSE-MIT.cuzk and the LICENCE-APACHE.cuzk
+// file.
+
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_CUZK_CUZK_CPU_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_CUZK_CUZK_CPU_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk_csr_sparse_matrix.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk_ell_sparse_matrix.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+
+namespace tachyon::math {
+
+// CUZKCpu runs the sparse matrix formulation of |CUZK| on CPU threads. For
+// each window,
+//
+//   1. Each thread writes the bucket indices of its own rows of bases into an
+//      ELL matrix, whose (row, col) element is the bucket index of the col-th
+//      base of the row.
+//   2. The ELL matrix is transposed into a CSR matrix, whose row is a bucket
+//      and whose elements are the bases which go into the bucket.
+//   3. The buckets are computed as a product of the CSR matrix and a vector
+//      of ones, i.e., the bases of each row are summed up.
+//   4. The buckets are reduced into the window sum.
+//
+// Unlike the buckets of |Pippenger|, which the threads of a window share, each
+// bucket is summed up by a single thread here, so that the threads don't
+// contend for the buckets.
+template <typename PointTy>
+class CUZKCpu : public PippengerBase<PointTy> {
+ public:
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename PippengerBase<PointTy>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+  // The bases of a bucket are split into pieces, so that a thread doesn't end
+  // up summing a whole bucket alone when the scalars are skewed. There are
+  // about this many pieces per thread.
+  constexpr static size_t kPiecesPerThread = 4;
+
+  CUZKCpu() = default;
+
+  void SetContextForTesting(const PippengerCtx& ctx) { ctx_ = ctx; }
+
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  bool Run(BaseInputIterator bases_first, BaseInputIterator bases_last,
+           ScalarInputIterator scalars_first, ScalarInputIterator scalars_last,
+           Bucket* ret) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    if (bases_size != scalars_size) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+    if (scalars_size == 0) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+
+    if (ctx_.window_bits == 0 || ctx_.size != scalars_size) {
+      ctx_ = PippengerCtx::CreateDefault<ScalarField>(scalars_size);
+    }
+    thread_nums_ = base::GetNumOpenMPThreads();
+
+    std::vector<BigInt<N>> scalars(scalars_size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars_size; ++i) {
+      scalars[i] = (scalars_first + i)->ToBigInt();
+    }
+
+    CUZKELLSparseMatrix ell_matrix;
+    ell_matrix.rows =
+        static_cast<unsigned int>(std::min(thread_nums_, scalars_size));
+    ell_matrix.cols = (ctx_.size + ell_matrix.rows - 1) / ell_matrix.rows;
+    std::vector<unsigned int> row_lengths(ell_matrix.rows);
+    std::vector<unsigned int> col_indices(ell_matrix.rows * ell_matrix.cols);
+    ell_matrix.row_lengths = row_lengths.data();
+    ell_matrix.col_indices = col_indices.data();
+
+    CUZKCSRSparseMatrix csr_matrix_transposed;
+    csr_matrix_transposed.rows = ctx_.GetWindowLength();
+    csr_matrix_transposed.cols = ell_matrix.rows;
+    std::vector<unsigned int> row_ptrs(csr_matrix_transposed.rows + 1);
+    std::vector<CUZKCSRSparseMatrix::Element> col_datas(ctx_.size);
+    csr_matrix_transposed.row_ptrs = row_ptrs.data();
+    csr_matrix_transposed.col_datas = col_datas.data();
+    csr_matrix_transposed.col_datas_size = ctx_.size;
+
+    std::vector<unsigned int> row_ptr_offsets(col_indices.size());
+    std::vector<Bucket> buckets(csr_matrix_transposed.rows);
+    std::vector<Bucket> window_sums(ctx_.window_count);
+    for (unsigned int i = 0; i < ctx_.window_count; ++i) {
+      WriteBucketIndexesToELLMatrix(scalars, i, ell_matrix);
+      ConvertELLToCSRTransposed(ell_matrix, csr_matrix_transposed,
+                                row_ptr_offsets.data());
+      MultiplyCSRMatrixWithOneVector(csr_matrix_transposed, bases_first,
+                                     buckets);
+      // The 0-th bucket collects the bases whose digit is zero.
+      window_sums[i] = this->AccumulateBucketsInSegments(
+          absl::MakeConstSpan(buckets).subspan(1), thread_nums_);
+    }
+    *ret = this->AccumulateWindowSums(window_sums, ctx_.window_bits);
+    return true;
+  }
+
+ private:
+  void WriteBucketIndexesToELLMatrix(const std::vector<BigInt<N>>& scalars,
+                                     unsigned int window_index,
+                                     CUZKELLSparseMatrix& ell_matrix) const {
+    size_t bit_offset = window_index * ctx_.window_bits;
+    OPENMP_PARALLEL_FOR(unsigned int row = 0; row < ell_matrix.rows; ++row) {
+      ell_matrix.row_lengths[row] = 0;
+      size_t start = size_t{row} * ell_matrix.cols;
+      size_t end = std::min(start + ell_matrix.cols, scalars.size());
+      for (size_t i = start; i < end; ++i) {
+        ell_matrix.Insert(
+            row, scalars[i].ExtractBits32(bit_offset, ctx_.window_bits));
+      }
+    }
+  }
+
+  // The element of the i-th base in the ELL matrix, the (i / cols)-th row and
+  // the (i % cols)-th col, is moved to the row of its bucket index, where its
+  // position is decided by counting the elements of the row in
+  // |row_ptr_offsets| first.
+  static void ConvertELLToCSRTransposed(const CUZKELLSparseMatrix& ell_matrix,
+                                        CUZKCSRSparseMatrix& csr_matrix,
+                                        unsigned int* row_ptr_offsets) {
+    std::fill_n(csr_matrix.row_ptrs, csr_matrix.rows + 1, 0);
+    OPENMP_PARALLEL_FOR(unsigned int row = 0; row < ell_matrix.rows; ++row) {
+      size_t offset = size_t{row} * ell_matrix.cols;
+      for (unsigned int col = 0; col < ell_matrix.row_lengths[row]; ++col) {
+        unsigned int& count =
+            csr_matrix.row_ptrs[ell_matrix.col_indices[offset + col] + 1];
+#if defined(TACHYON_HAS_OPENMP)
+#pragma omp atomic capture
+#endif  // defined(TACHYON_HAS_OPENMP)
+        row_ptr_offsets[offset + col] = count++;
+      }
+    }
+
+    std::partial_sum(csr_matrix.row_ptrs,
+                     csr_matrix.row_ptrs + csr_matrix.rows + 1,
+                     csr_matrix.row_ptrs);
+
+    OPENMP_PARALLEL_FOR(unsigned int row = 0; row < ell_matrix.rows; ++row) {
+      size_t offset = size_t{row} * ell_matrix.cols;
+      for (unsigned int col = 0; col < ell_matrix.row_lengths[row]; ++col) {
+        unsigned int bucket_index = ell_matrix.col_indices[offset + col];
+        unsigned int idx =
+            csr_matrix.row_ptrs[bucket_index] + row_ptr_offsets[offset + col];
+        csr_matrix.col_datas[idx] = {row,
+                                     static_cast<unsigned int>(offset + col)};
+      }
+    }
+  }
+
+  template <typename BaseInputIterator>
+  void MultiplyCSRMatrixWithOneVector(const CUZKCSRSparseMatrix& csr_matrix,
+                                      BaseInputIterator bases_first,
+                                      std::vector<Bucket>& buckets) const {
+    struct Piece {
+      unsigned int row;
+      unsigned int start;
+      unsigned int end;
+    };
+
+    unsigned int piece_size = static_cast<unsigned int>(std::max(
+        ctx_.size / (thread_nums_ * kPiecesPerThread), size_t{1}));
+    std::vector<Piece> pieces;
+    // The 0-th row is skipped, since its bucket is never used.
+    for (unsigned int row = 1; row < csr_matrix.rows; ++row) {
+      unsigned int end = csr_matrix.row_ptrs[row + 1];
+      for (unsigned int start = csr_matrix.row_ptrs[row]; start < end;
+           start += piece_size) {
+        pieces.push_back({row, start, std::min(start + piece_size, end)});
+      }
+    }
+
+    std::vector<Bucket> piece_sums(pieces.size());
+    OPENMP_PARALLEL_FOR_DYNAMIC(size_t i = 0; i < pieces.size(); ++i) {
+      Bucket sum = Bucket::Zero();
+      for (unsigned int j = pieces[i].start; j < pieces[i].end; ++j) {
+        sum += *(bases_first + csr_matrix.col_datas[j].data_addr);
+      }
+      piece_sums[i] = sum;
+    }
+
+    std::fill(buckets.begin(), buckets.end(), Bucket::Zero());
+    for (size_t i = 0; i < pieces.size(); ++i) {
+      buckets[pieces[i].row] += piece_sums[i];
+    }
+  }
+
+  PippengerCtx ctx_;
+  size_t thread_nums_ = 1;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_CUZK_CUZK_CPU_H_
@@ -0,0 +1,46 @@
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk_cpu.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+template <typename PointTy, bool IsRandom>
+void BM_CUZKCpu(benchmark::State& state) {
+  PointTy::Curve::Init();
+  MSMTestSet<PointTy> test_set;
+  if constexpr (IsRandom) {
+    test_set = MSMTestSet<PointTy>::Random(state.range(0), MSMMethod::kNone);
+  } else {
+    test_set =
+        MSMTestSet<PointTy>::NonUniform(state.range(0), 10, MSMMethod::kNone);
+  }
+  CUZKCpu<PointTy> cuzk;
+  using Bucket = typename CUZKCpu<PointTy>::Bucket;
+  Bucket ret;
+  for (auto _ : state) {
+    cuzk.Run(test_set.bases.begin(), test_set.bases.end(),
+             test_set.scalars.begin(), test_set.scalars.end(), &ret);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename PointTy>
+void BM_CUZKCpuRandom(benchmark::State& state) {
+  BM_CUZKCpu<PointTy, true>(state);
+}
+
+template <typename PointTy>
+void BM_CUZKCpuNonUniform(benchmark::State& state) {
+  BM_CUZKCpu<PointTy, false>(state);
+}
+
+BENCHMARK_TEMPLATE(BM_CUZKCpuRandom, bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_CUZKCpuNonUniform, bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+
+}  // namespace tachyon::math
@@ -0,0 +1,94 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk_cpu.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 100;
+
+template <typename PointTy>
+class CUZKCpuTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bls12_381::G1AffinePoint>;
+TYPED_TEST_SUITE(CUZKCpuTest, PointTypes);
+
+TYPED_TEST(CUZKCpuTest, Run) {
+  using PointTy = TypeParam;
+  using Bucket = typename CUZKCpu<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNaive);
+
+  CUZKCpu<PointTy> cuzk;
+  Bucket ret;
+  ASSERT_TRUE(cuzk.Run(test_set.bases.begin(), test_set.bases.end(),
+                       test_set.scalars.begin(), test_set.scalars.end(),
+                       &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+TYPED_TEST(CUZKCpuTest, RunWithSkewedScalars) {
+  using PointTy = TypeParam;
+  using Bucket = typename CUZKCpu<PointTy>::Bucket;
+
+  // Only a few buckets of each window are filled, each with many bases.
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::NonUniform(kSize, 3, MSMMethod::kNaive);
+
+  CUZKCpu<PointTy> cuzk;
+  Bucket ret;
+  ASSERT_TRUE(cuzk.Run(test_set.bases.begin(), test_set.bases.end(),
+                       test_set.scalars.begin(), test_set.scalars.end(),
+                       &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+TYPED_TEST(CUZKCpuTest, RunWithContext) {
+  using PointTy = TypeParam;
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename CUZKCpu<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNaive);
+
+  for (unsigned int window_bits : {1, 7, 12}) {
+    SCOPED_TRACE(window_bits);
+    CUZKCpu<PointTy> cuzk;
+    cuzk.SetContextForTesting(
+        PippengerCtx::Create<ScalarField>(kSize, window_bits));
+    Bucket ret;
+    ASSERT_TRUE(cuzk.Run(test_set.bases.begin(), test_set.bases.end(),
+                         test_set.scalars.begin(), test_set.scalars.end(),
+                         &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(CUZKCpuTest, RunWithMismatchedSizes) {
+  using PointTy = TypeParam;
+  using Bucket = typename CUZKCpu<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+
+  CUZKCpu<PointTy> cuzk;
+  Bucket ret;
+  EXPECT_FALSE(cuzk.Run(test_set.bases.begin(), test_set.bases.end() - 1,
+                        test_set.scalars.begin(), test_set.scalars.end(),
+                        &ret));
+}
+
+}  // namespace tachyon::math
@@ -4,15 +4,10 @@
 #include "tachyon/device/gpu/gpu_memory.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/jacobian_point.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/msm_algorithm_kind.h"
 
 namespace tachyon::math {
 
-enum class MSMAlgorithmKind {
-  kBellmanMSM,
-  kCUZK,
-  kPippenger,
-};
-
 template <typename GpuCurve>
 class MSMGpuAlgorithm {
  public:
@@ -0,0 +1,14 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_MSM_ALGORITHM_KIND_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_MSM_ALGORITHM_KIND_H_
+
+namespace tachyon::math {
+
+enum class MSMAlgorithmKind {
+  kBellmanMSM,
+  kCUZK,
+  kPippenger,
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_MSM_ALGORITHM_KIND_H_
@@ -0,0 +1,77 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_accumulator.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Curve>
+class BatchAffineAccumulatorTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Curve::Init(); }
+};
+
+}  // namespace
+
+// The denominators of G2 are in a quadratic extension field, which are
+// inverted through their norms.
+using CurveTypes = testing::Types<bn254::G1Curve, bn254::G2Curve>;
+TYPED_TEST_SUITE(BatchAffineAccumulatorTest, CurveTypes);
+
+TYPED_TEST(BatchAffineAccumulatorTest, Add) {
+  using Curve = TypeParam;
+  using AffinePointTy = AffinePoint<Curve>;
+  using PointXYZZTy = PointXYZZ<Curve>;
+
+  constexpr size_t kBucketSize = 16;
+
+  AffinePointTy p = AffinePointTy::Random();
+  AffinePointTy q = AffinePointTy::Random();
+
+  struct {
+    size_t batch_size;
+    std::vector<std::vector<AffinePointTy>> additions;
+  } tests[] = {
+      // Generic additions.
+      {4, {{p, q}, {q}, {p, p, q}}},
+      // Doubling.
+      {4, {{p, p}, {q, q, q, q}}},
+      // Cancellation.
+      {4, {{p, -p}, {p, -p, q}}},
+      // Collisions that are deferred and then spilled.
+      {1, {{p, q, p, q, p, q, -q}, {p}}},
+  };
+
+  for (const auto& test : tests) {
+    BatchAffineAccumulator<Curve> accumulator(kBucketSize, test.batch_size);
+    std::vector<PointXYZZTy> expected =
+        base::CreateVector(kBucketSize, PointXYZZTy::Zero());
+    // Interleave additions across buckets to make batches mix them.
+    size_t max_length = 0;
+    for (const std::vector<AffinePointTy>& points : test.additions) {
+      max_length = std::max(max_length, points.size());
+    }
+    for (size_t i = 0; i < max_length; ++i) {
+      for (size_t j = 0; j < test.additions.size(); ++j) {
+        if (i >= test.additions[j].size()) continue;
+        accumulator.Add(j, test.additions[j][i]);
+        expected[j] += test.additions[j][i];
+      }
+    }
+    accumulator.Flush();
+
+    std::vector<PointXYZZTy> buckets =
+        std::move(accumulator).TakeMergedBuckets();
+    EXPECT_EQ(buckets, expected);
+  }
+}
+
+}  // namespace tachyon::math
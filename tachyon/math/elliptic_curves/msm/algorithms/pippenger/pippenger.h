@@ -6,50 +6,29 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_H_
 
+#include <stdint.h>
+
 #include <algorithm>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "tachyon/base/compiler_specific.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/batch_affine_accumulator.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/window_digits.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
 #include "tachyon/math/elliptic_curves/msm/msm_util.h"
 #include "tachyon/math/elliptic_curves/semigroups.h"
 
 namespace tachyon::math {
 
-// From:
-// https://github.com/arkworks-rs/gemini/blob/main/src/kzg/msm/variable_base.rs#L20
-template <size_t N>
-void FillDigits(const BigInt<N>& scalar, size_t window_bits,
-                std::vector<int64_t>* digits) {
-  uint64_t radix = 1 << window_bits;
-
-  uint64_t carry = 0;
-  size_t bit_offset = 0;
-  for (size_t i = 0; i < digits->size(); ++i) {
-    // Construct a buffer of bits of the |scalar|, starting at
-    // `bit_offset`.
-    uint64_t bits = scalar.ExtractBits64(bit_offset, window_bits);
-
-    // Read the actual coefficient value from the window
-    uint64_t coeff = carry + bits;  // coeff = [0, 2^|window_bits|)
-
-    // Recenter coefficients from [0,2^|window_bits|) to
-    // [-2^|window_bits|/2, 2^|window_bits|/2)
-    carry = (coeff + radix / 2) >> window_bits;
-    (*digits)[i] = static_cast<int64_t>(coeff) -
-                   static_cast<int64_t>(carry << window_bits);
-    bit_offset += window_bits;
-  }
-
-  digits->back() += static_cast<int64_t>(carry << window_bits);
-}
-
 template <typename PointTy>
 class Pippenger : public PippengerBase<PointTy> {
  public:
@@ -57,6 +36,20 @@ class Pippenger : public PippengerBase<PointTy> {
   using Bucket = typename PippengerBase<PointTy>::Bucket;
 
   constexpr static size_t N = ScalarField::N;
+  // The largest window bits |WindowDigits<int32_t>| can hold.
+  constexpr static unsigned int kMaxWindowBits = 30;
+  // See |ComputeChunkCount()|.
+  constexpr static size_t kTasksPerThread = 4;
+  // See |ReduceBuckets()|.
+  constexpr static size_t kMinBucketsPerSegment = size_t{1} << 10;
+  // Buckets can be kept in affine form only when bases are affine points.
+  constexpr static bool kCanUseBatchAffine =
+      std::is_same_v<PointTy, AffinePoint<typename PointTy::Curve>>;
+  // Buckets are kept in affine form by default over extension fields, e.g.,
+  // G2, where a field multiplication is several times more expensive, so that
+  // the multiplications batch affine saves per addition weigh more.
+  constexpr static bool kUseBatchAffineByDefault =
+      kCanUseBatchAffine && PointTy::BaseField::ExtensionDegree() > 1;
 
   Pippenger() : use_msm_window_naf_(PointTy::kNegationIsCheap) {
 #if defined(TACHYON_HAS_OPENMP)
@@ -64,6 +57,9 @@ class Pippenger : public PippengerBase<PointTy> {
 #endif  // defined(TACHYON_HAS_OPENMP)
   }
 
+  bool use_batch_affine() const { return use_batch_affine_; }
+  bool use_bucket_sort() const { return use_bucket_sort_; }
+
   void SetParallelWindows(bool parallel_windows) {
     parallel_windows_ = parallel_windows;
 #if !defined(TACHYON_HAS_OPENMP)
@@ -71,6 +67,71 @@ class Pippenger : public PippengerBase<PointTy> {
 #endif  // !defined(TACHYON_HAS_OPENMP)
   }
 
+  // When enabled, buckets are accumulated in affine form with batched
+  // inversions. See batch_affine_accumulator.h for details. This is only
+  // applied to the window NAF method. The default is
+  // |kUseBatchAffineByDefault|. Enabling it disables bucket sort. See
+  // |SetUseBucketSort()|.
+  void SetUseBatchAffine(bool use_batch_affine) {
+    use_batch_affine_ = use_batch_affine;
+    if constexpr (kCanUseBatchAffine) {
+      if (use_batch_affine) use_bucket_sort_ = false;
+    } else {
+      LOG_IF(WARNING, use_batch_affine)
+          << "Set batch affine with non-affine bases";
+    }
+  }
+
+  // When enabled, the additions of each window are sorted by bucket first, so
+  // that every bucket is accumulated in a row while the bases are prefetched.
+  // This helps when the buckets of a window don't fit in cache. This is only
+  // applied to the window NAF method. It can't be combined with batch affine,
+  // which needs additions to different buckets next to each other, so
+  // enabling it disables batch affine, even where it's on by default.
+  void SetUseBucketSort(bool use_bucket_sort) {
+    use_bucket_sort_ = use_bucket_sort;
+    if (use_bucket_sort) use_batch_affine_ = false;
+  }
+
+  // Overrides the window bits which |PippengerCtx::ComputeWindowsBits()|
+  // picks for the size, e.g., with the ones found by |PippengerAutotuner|.
+  // 0 restores the default.
+  void SetWindowBits(unsigned int window_bits) {
+    DCHECK_LE(window_bits, kMaxWindowBits);
+    window_bits_ = window_bits;
+  }
+
+  // Splits the bases into |chunk_count| chunks, so that the windows are
+  // accumulated as a grid of (window, chunk) tasks. With parallel windows, the
+  // tasks are handed out to whichever thread is free, which keeps every
+  // thread busy even with fewer windows than threads. The partial sums of the
+  // chunks are added up per window at the end. 0 picks the count by
+  // |ComputeChunkCount()| and 1, the default, keeps a task per window.
+  void SetChunkCount(size_t chunk_count) { chunk_count_ = chunk_count; }
+
+  // Returns the number of threads the windows run on.
+  static size_t GetThreadNums() { return base::GetNumOpenMPThreads(); }
+
+  // Returns the number of chunks which gives each of |thread_nums| threads
+  // |kTasksPerThread| tasks, so that a thread which is done early takes over
+  // the rest. A chunk is kept larger than the buckets of a window, since every
+  // chunk reduces its own buckets.
+  constexpr static size_t ComputeChunkCount(const PippengerCtx& ctx,
+                                            size_t thread_nums) {
+    size_t task_count = thread_nums * kTasksPerThread;
+    size_t chunk_count = (task_count + ctx.window_count - 1) / ctx.window_count;
+    size_t max_chunk_count =
+        std::max(size_t{ctx.size >> ctx.window_bits}, size_t{1});
+    return std::clamp(chunk_count, size_t{1}, max_chunk_count);
+  }
+
+  // |Run()| and |RunWithWindowDigits()| add their phases and buckets to
+  // |stats| when built with TACHYON_HAS_MSM_STATS. See msm_stats.h. With the
+  // window NAF method, the scalars are then converted apart from their
+  // decomposition to be timed apart. |stats| is not owned and nullptr, the
+  // default, disables it.
+  void SetStats(MSMStats* stats) { stats_ = stats; }
+
   void SetUseMSMWindowNAForTesting(bool use_msm_window_naf) {
     use_msm_window_naf_ = use_msm_window_naf;
   }
@@ -87,77 +148,329 @@ class Pippenger : public PippengerBase<PointTy> {
       LOG(ERROR) << "bases_size and scalars_size don't match";
       return false;
     }
-    ctx_ = PippengerCtx::CreateDefault<ScalarField>(scalars_size);
-
-    std::vector<BigInt<N>> scalars;
-    scalars.resize(scalars_size);
-    auto scalars_it = scalars_first;
-    for (size_t i = 0; i < scalars_size; ++i, ++scalars_it) {
-      scalars[i] = scalars_it->ToBigInt();
-    }
+    ctx_ = CreateCtx(scalars_size);
 
     std::vector<Bucket> window_sums =
         base::CreateVector(ctx_.window_count, Bucket::Zero());
 
     if (use_msm_window_naf_) {
-      AccumulateWindowNAFSums(std::move(bases_first), scalars, &window_sums);
+      if (WindowDigits<int16_t>::CanHoldDigits(ctx_.window_bits)) {
+        AccumulateWindowNAFSums<int16_t>(std::move(bases_first),
+                                         std::move(scalars_first),
+                                         &window_sums);
+      } else {
+        AccumulateWindowNAFSums<int32_t>(std::move(bases_first),
+                                         std::move(scalars_first),
+                                         &window_sums);
+      }
     } else {
+      std::vector<BigInt<N>> scalars = ConvertScalars(scalars_first);
       AccumulateWindowSums(std::move(bases_first), scalars, &window_sums);
     }
 
+    MSMPhaseTimer timer(stats_, MSMPhase::kWindowCombine);
+    *ret = PippengerBase<PointTy>::AccumulateWindowSums(
+        absl::MakeConstSpan(window_sums), ctx_.window_bits);
+    return true;
+  }
+
+  // Same as |Run()|, but with scalars which are already decomposed into
+  // |digits|, e.g., scalars shorter than |ScalarField| or with signs. The
+  // window bits of |digits| should be the ones |PippengerCtx| picks for the
+  // size, and the digits of the last window can be as large as
+  // 2^|window_bits|. This always uses the window NAF method.
+  template <typename BaseInputIterator, typename Digit>
+  bool RunWithWindowDigits(BaseInputIterator bases_first,
+                           BaseInputIterator bases_last,
+                           const WindowDigits<Digit>& digits, Bucket* ret) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    if (bases_size != digits.size()) {
+      LOG(ERROR) << "bases_size and digits_size don't match";
+      return false;
+    }
+    ctx_.window_bits = digits.window_bits();
+    ctx_.window_count = digits.window_count();
+    ctx_.size = bases_size;
+
+    std::vector<Bucket> window_sums =
+        base::CreateVector(ctx_.window_count, Bucket::Zero());
+    AccumulateWindowNAFSumsWithDigits(std::move(bases_first), digits,
+                                      &window_sums);
+    MSMPhaseTimer timer(stats_, MSMPhase::kWindowCombine);
     *ret = PippengerBase<PointTy>::AccumulateWindowSums(
         absl::MakeConstSpan(window_sums), ctx_.window_bits);
     return true;
   }
 
  private:
-  template <typename BaseInputIterator>
-  void AccumulateSingleWindowNAFSum(
-      BaseInputIterator bases_it,
-      const std::vector<std::vector<int64_t>>& scalar_digits, size_t i,
-      Bucket* window_sum, bool is_last_window) {
+  PippengerCtx CreateCtx(size_t size) const {
+    if (window_bits_ == 0) {
+      return PippengerCtx::CreateDefault<ScalarField>(size);
+    }
+    return PippengerCtx::Create<ScalarField>(size, window_bits_);
+  }
+
+  // Calls |accumulate(i, start, end, &partial_sum)| for the i-th window over
+  // the bases in [start, end) of every chunk and adds up the partial sums of
+  // each window into |window_sums|.
+  template <typename Accumulate>
+  void AccumulateWindowSumsInChunks(Accumulate accumulate,
+                                    std::vector<Bucket>* window_sums) {
+    size_t chunk_count = chunk_count_;
+    if (chunk_count == 0) {
+      chunk_count = ComputeChunkCount(ctx_, GetThreadNums());
+    }
+    chunk_count =
+        std::min(chunk_count, std::max(size_t{ctx_.size}, size_t{1}));
+    size_t chunk_size = (ctx_.size + chunk_count - 1) / chunk_count;
+    size_t task_count = ctx_.window_count * chunk_count;
+    // |partial_sums[j * window_count + i]| is the partial sum of the i-th
+    // window over the j-th chunk. The tasks of a chunk are next to each other,
+    // so that the threads running them at the same time share its bases in
+    // cache.
+    std::vector<Bucket> partial_sums =
+        base::CreateVector(task_count, Bucket::Zero());
+    auto run_task = [this, &accumulate, &partial_sums, chunk_size](
+                        size_t task) {
+      size_t i = task % ctx_.window_count;
+      size_t start = task / ctx_.window_count * chunk_size;
+      size_t end = std::min(start + chunk_size, size_t{ctx_.size});
+      if (start < end) accumulate(i, start, end, &partial_sums[task]);
+    };
+    if (parallel_windows_) {
+      OPENMP_PARALLEL_FOR_DYNAMIC(size_t task = 0; task < task_count; ++task) {
+        run_task(task);
+      }
+    } else {
+      for (size_t task = 0; task < task_count; ++task) {
+        run_task(task);
+      }
+    }
+    MSMPhaseTimer timer(stats_, MSMPhase::kWindowCombine);
+    for (size_t task = 0; task < task_count; ++task) {
+      (*window_sums)[task % ctx_.window_count] += partial_sums[task];
+    }
+  }
+
+  // Reduces |buckets| in segments on as many threads as they keep busy. The
+  // buckets of a large window take long to reduce, and when there are fewer
+  // windows than threads, the threads which are done would otherwise wait for
+  // it. See |PippengerBase::AccumulateBucketsInSegments()|.
+  template <typename BucketTy>
+  Bucket ReduceBuckets(absl::Span<const BucketTy> buckets,
+                       const Bucket& initial_value = Bucket::Zero()) const {
+    MSMPhaseTimer timer(stats_, MSMPhase::kBucketReduction);
+    size_t segment_count = 1;
+    if (parallel_windows_) {
+      segment_count =
+          std::min(GetThreadNums(), buckets.size() / kMinBucketsPerSegment);
+    }
+    return PippengerBase<PointTy>::AccumulateBucketsInSegments(
+        buckets, segment_count, initial_value);
+  }
+
+  template <typename ScalarInputIterator>
+  std::vector<BigInt<N>> ConvertScalars(ScalarInputIterator scalars_first) {
+    MSMPhaseTimer timer(stats_, MSMPhase::kScalarConversion);
+    std::vector<BigInt<N>> scalars(ctx_.size);
+    if (parallel_windows_) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars.size(); ++i) {
+        scalars[i] = (scalars_first + i)->ToBigInt();
+      }
+    } else {
+      for (size_t i = 0; i < scalars.size(); ++i, ++scalars_first) {
+        scalars[i] = scalars_first->ToBigInt();
+      }
+    }
+    return scalars;
+  }
+
+  template <typename BaseInputIterator, typename Digit>
+  void AccumulateSingleWindowNAFSum(BaseInputIterator bases_it,
+                                    absl::Span<const Digit> window_digits,
+                                    Bucket* window_sum, bool is_last_window) {
     size_t bucket_size;
     if (is_last_window) {
       bucket_size = 1 << ctx_.window_bits;
     } else {
       bucket_size = 1 << (ctx_.window_bits - 1);
     }
+    CountBucketSizes(window_digits, bucket_size);
+    if constexpr (kCanUseBatchAffine) {
+      if (use_batch_affine_) {
+        AccumulateSingleWindowNAFSumBatchAffine(
+            std::move(bases_it), window_digits, bucket_size, window_sum);
+        return;
+      }
+    }
+    if (use_bucket_sort_ &&
+        window_digits.size() <=
+            static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+      AccumulateSingleWindowNAFSumSorted(std::move(bases_it), window_digits,
+                                         bucket_size, window_sum);
+      return;
+    }
+    MSMPhaseTimer timer(stats_, MSMPhase::kBucketAccumulation);
     std::vector<Bucket> buckets =
         base::CreateVector(bucket_size, Bucket::Zero());
-    for (size_t j = 0; j < scalar_digits.size(); ++j, ++bases_it) {
-      const PointTy& base = *bases_it;
-      int64_t scalar = scalar_digits[j][i];
+    for (Digit scalar : window_digits) {
+      const PointTy& base = *(bases_it++);
       if (0 < scalar) {
         buckets[static_cast<uint64_t>(scalar - 1)] += base;
       } else if (0 > scalar) {
         buckets[static_cast<uint64_t>(-scalar - 1)] -= base;
       }
     }
-    *window_sum =
-        PippengerBase<PointTy>::AccumulateBuckets(absl::MakeConstSpan(buckets));
+    timer.Stop();
+    *window_sum = ReduceBuckets(absl::MakeConstSpan(buckets));
   }
 
-  template <typename BaseInputIterator>
-  void AccumulateWindowNAFSums(BaseInputIterator bases_first,
-                               absl::Span<const BigInt<N>> scalars,
-                               std::vector<Bucket>* window_sums) {
-    std::vector<std::vector<int64_t>> scalar_digits;
-    scalar_digits.resize(scalars.size());
-    for (std::vector<int64_t>& scalar_digit : scalar_digits) {
-      scalar_digit.resize(ctx_.window_count);
+  template <typename Digit>
+  void CountBucketSizes(absl::Span<const Digit> window_digits,
+                        size_t bucket_size) const {
+    MSMBucketCounter counter(stats_, bucket_size);
+    if (!MSMStats::kEnabled || stats_ == nullptr) return;
+    for (Digit scalar : window_digits) {
+      if (scalar != 0) {
+        counter.Count(static_cast<uint64_t>(scalar < 0 ? -scalar : scalar) -
+                      1);
+      }
+    }
+  }
+
+  // Scattering additions over buckets in input order misses the cache on
+  // almost every addition once the buckets of a window outgrow it. Instead,
+  // the base indices are counting-sorted by bucket, and then each bucket is
+  // accumulated in a local variable while reading the bases in sorted order.
+  template <typename BaseInputIterator, typename Digit>
+  void AccumulateSingleWindowNAFSumSorted(BaseInputIterator bases_first,
+                                          absl::Span<const Digit> window_digits,
+                                          size_t bucket_size,
+                                          Bucket* window_sum) {
+    // The number of bases to prefetch ahead of the one being added.
+    constexpr size_t kPrefetchDistance = 8;
+
+    MSMPhaseTimer timer(stats_, MSMPhase::kBucketAccumulation);
+    // |offsets[i]| is where the entries of the i-th bucket start.
+    std::vector<uint32_t> offsets(bucket_size + 1, 0);
+    for (Digit scalar : window_digits) {
+      if (scalar != 0) {
+        ++offsets[static_cast<uint64_t>(scalar < 0 ? -scalar : scalar)];
+      }
+    }
+    for (size_t i = 1; i <= bucket_size; ++i) {
+      offsets[i] += offsets[i - 1];
+    }
+    // The entry is the index of a base to add or the bitwise NOT of the index
+    // of a base to subtract.
+    std::vector<int32_t> entries(offsets.back());
+    std::vector<uint32_t> cursors(offsets.begin(), offsets.end() - 1);
+    for (size_t j = 0; j < window_digits.size(); ++j) {
+      Digit scalar = window_digits[j];
+      if (0 < scalar) {
+        entries[cursors[scalar - 1]++] = static_cast<int32_t>(j);
+      } else if (0 > scalar) {
+        entries[cursors[-scalar - 1]++] = ~static_cast<int32_t>(j);
+      }
     }
-    for (size_t i = 0; i < scalars.size(); ++i) {
-      FillDigits(scalars[i], ctx_.window_bits, &scalar_digits[i]);
+
+    std::vector<Bucket> buckets(bucket_size);
+    for (size_t i = 0; i < bucket_size; ++i) {
+      Bucket bucket = Bucket::Zero();
+      for (uint32_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+        if (k + kPrefetchDistance < entries.size()) {
+          int32_t next = entries[k + kPrefetchDistance];
+          PREFETCH_FOR_READ(&*(bases_first + (next < 0 ? ~next : next)));
+        }
+        int32_t entry = entries[k];
+        if (entry >= 0) {
+          bucket += *(bases_first + entry);
+        } else {
+          bucket -= *(bases_first + ~entry);
+        }
+      }
+      buckets[i] = std::move(bucket);
     }
+    timer.Stop();
+    *window_sum = ReduceBuckets(absl::MakeConstSpan(buckets));
+  }
+
+  template <typename BaseInputIterator, typename Digit>
+  void AccumulateSingleWindowNAFSumBatchAffine(
+      BaseInputIterator bases_it, absl::Span<const Digit> window_digits,
+      size_t bucket_size, Bucket* window_sum) {
+    MSMPhaseTimer timer(stats_, MSMPhase::kBucketAccumulation);
+    BatchAffineAccumulator<typename PointTy::Curve> accumulator(bucket_size);
+    for (Digit scalar : window_digits) {
+      const PointTy& base = *(bases_it++);
+      if (0 < scalar) {
+        accumulator.Add(static_cast<uint64_t>(scalar - 1), base);
+      } else if (0 > scalar) {
+        accumulator.Add(static_cast<uint64_t>(-scalar - 1), -base);
+      }
+    }
+    accumulator.Flush();
+    if (accumulator.has_spilled_buckets()) {
+      std::vector<Bucket> buckets = std::move(accumulator).TakeMergedBuckets();
+      timer.Stop();
+      *window_sum = ReduceBuckets(absl::MakeConstSpan(buckets));
+    } else {
+      timer.Stop();
+      *window_sum = ReduceBuckets(absl::MakeConstSpan(accumulator.buckets()));
+    }
+  }
+
+  template <typename Digit, typename BaseInputIterator,
+            typename ScalarInputIterator>
+  void AccumulateWindowNAFSums(BaseInputIterator bases_first,
+                               ScalarInputIterator scalars_first,
+                               std::vector<Bucket>* window_sums) {
+#if defined(TACHYON_HAS_MSM_STATS)
+    std::vector<BigInt<N>> scalars = ConvertScalars(scalars_first);
+    MSMPhaseTimer timer(stats_, MSMPhase::kDigitDecomposition);
+    WindowDigits<Digit> digits(ctx_.size, ctx_.window_bits, ctx_.window_count);
     if (parallel_windows_) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars.size(); ++i) {
+        digits.Fill(i, scalars[i]);
+      }
+    } else {
+      for (size_t i = 0; i < scalars.size(); ++i) {
+        digits.Fill(i, scalars[i]);
+      }
+    }
+    timer.Stop();
+#else
+    WindowDigits<Digit> digits = WindowDigits<Digit>::Decompose(
+        std::move(scalars_first), ctx_.size, ctx_.window_bits,
+        ctx_.window_count, parallel_windows_);
+#endif  // defined(TACHYON_HAS_MSM_STATS)
+    AccumulateWindowNAFSumsWithDigits(std::move(bases_first), digits,
+                                      window_sums);
+  }
+
+  template <typename BaseInputIterator, typename Digit>
+  void AccumulateWindowNAFSumsWithDigits(BaseInputIterator bases_first,
+                                         const WindowDigits<Digit>& digits,
+                                         std::vector<Bucket>* window_sums) {
+    if (chunk_count_ != 1) {
+      AccumulateWindowSumsInChunks(
+          [this, &bases_first, &digits](size_t i, size_t start, size_t end,
+                                        Bucket* partial_sum) {
+            AccumulateSingleWindowNAFSum(
+                bases_first + start,
+                digits.GetWindow(i).subspan(start, end - start), partial_sum,
+                i == ctx_.window_count - 1);
+          },
+          window_sums);
+    } else if (parallel_windows_) {
       OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
+        AccumulateSingleWindowNAFSum(bases_first, digits.GetWindow(i),
                                      &(*window_sums)[i],
                                      i == ctx_.window_count - 1);
       }
     } else {
       for (size_t i = 0; i < ctx_.window_count; ++i) {
-        AccumulateSingleWindowNAFSum(bases_first, scalar_digits, i,
+        AccumulateSingleWindowNAFSum(bases_first, digits.GetWindow(i),
                                      &(*window_sums)[i],
                                      i == ctx_.window_count - 1);
       }
@@ -168,11 +481,13 @@ class Pippenger : public PippengerBase<PointTy> {
   void AccumulateSingleWindowSum(BaseInputIterator bases_first,
                                  absl::Span<const BigInt<N>> scalars,
                                  size_t window_offset, Bucket* out) {
+    MSMPhaseTimer timer(stats_, MSMPhase::kBucketAccumulation);
     Bucket window_sum = Bucket::Zero();
     // We don't need the "zero" bucket, so we only have 2^{window_bits} - 1
     // buckets.
     std::vector<Bucket> buckets =
         base::CreateVector((1 << ctx_.window_bits) - 1, Bucket::Zero());
+    MSMBucketCounter counter(stats_, buckets.size());
     auto bases_it = bases_first;
     for (size_t j = 0; j < scalars.size(); ++j, ++bases_it) {
       const BigInt<N>& scalar = scalars[j];
@@ -199,18 +514,28 @@ class Pippenger : public PippengerBase<PointTy> {
         // (Recall that |buckets| doesn't have a zero bucket.)
         if (idx != 0) {
           buckets[idx - 1] += base;
+          counter.Count(idx - 1);
         }
       }
     }
-    *out = PippengerBase<PointTy>::AccumulateBuckets(
-        absl::MakeConstSpan(buckets), window_sum);
+    timer.Stop();
+    *out = ReduceBuckets(absl::MakeConstSpan(buckets), window_sum);
   }
 
   template <typename BaseInputIterator>
   void AccumulateWindowSums(BaseInputIterator bases_first,
                             absl::Span<const BigInt<N>> scalars,
                             std::vector<Bucket>* window_sums) {
-    if (parallel_windows_) {
+    if (chunk_count_ != 1) {
+      AccumulateWindowSumsInChunks(
+          [this, &bases_first, scalars](size_t i, size_t start, size_t end,
+                                        Bucket* partial_sum) {
+            AccumulateSingleWindowSum(bases_first + start,
+                                      scalars.subspan(start, end - start),
+                                      ctx_.window_bits * i, partial_sum);
+          },
+          window_sums);
+    } else if (parallel_windows_) {
       OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
         AccumulateSingleWindowSum(bases_first, scalars, ctx_.window_bits * i,
                                   &(*window_sums)[i]);
@@ -224,8 +549,14 @@ class Pippenger : public PippengerBase<PointTy> {
   }
 
   bool use_msm_window_naf_ = false;
+  bool use_batch_affine_ = kUseBatchAffineByDefault;
+  bool use_bucket_sort_ = false;
   bool parallel_windows_ = false;
   PippengerCtx ctx_;
+  unsigned int window_bits_ = 0;
+  size_t chunk_count_ = 1;
+  // not owned
+  MSMStats* stats_ = nullptr;
 };
 
 }  // namespace tachyon::math
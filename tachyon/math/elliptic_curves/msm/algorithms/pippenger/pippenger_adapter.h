@@ -1,34 +1,73 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_ADAPTER_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_ADAPTER_H_
 
-#include <algorithm>
+#include <iterator>
 #include <utility>
 #include <vector>
 
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_profile.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
 
 namespace tachyon::math {
 
-enum class PippengerParallelStrategy {
-  kNone,
-  kParallelWindow,
-  kParallelTerm,
-  kParallelWindowAndTerm,
-};
-
 template <typename PointTy>
 class PippengerAdapter {
  public:
   using ScalarField = typename PointTy::ScalarField;
   using Bucket = typename Pippenger<PointTy>::Bucket;
 
+  static_assert(PippengerProfile::kMaxWindowBits ==
+                    Pippenger<PointTy>::kMaxWindowBits,
+                "The profile must accept the window bits pippenger does");
+
+  // |Run()| takes the window bits and the parallel strategy from |profile|
+  // when it has an entry for the curve, the number of threads and a size
+  // close enough. See |PippengerProfile::Find()|. It is
+  // |PippengerProfile::GetDefault()| unless set otherwise, and nullptr
+  // disables it.
+  void SetProfile(const PippengerProfile* profile) { profile_ = profile; }
+
+  // See |Pippenger::SetWindowBits()|. This takes precedence over the profile.
+  void SetWindowBits(unsigned int window_bits) { window_bits_ = window_bits; }
+
+  // See |Pippenger::SetUseBatchAffine()|.
+  void SetUseBatchAffine(bool use_batch_affine) {
+    use_batch_affine_ = use_batch_affine;
+    if (Pippenger<PointTy>::kCanUseBatchAffine && use_batch_affine) {
+      use_bucket_sort_ = false;
+    }
+  }
+
+  // See |Pippenger::SetUseBucketSort()|.
+  void SetUseBucketSort(bool use_bucket_sort) {
+    use_bucket_sort_ = use_bucket_sort;
+    if (use_bucket_sort) use_batch_affine_ = false;
+  }
+
+  // See |Pippenger::SetStats()|.
+  void SetStats(MSMStats* stats) { stats_ = stats; }
+
   template <typename BaseInputIterator, typename ScalarInputIterator>
   bool Run(BaseInputIterator bases_first, BaseInputIterator bases_last,
            ScalarInputIterator scalars_first, ScalarInputIterator scalars_last,
            Bucket* ret) {
-    return RunWithStrategy(std::move(bases_first), std::move(bases_last),
-                           std::move(scalars_first), std::move(scalars_last),
-                           PippengerParallelStrategy::kParallelWindow, ret);
+    PippengerParallelStrategy strategy =
+        PippengerParallelStrategy::kParallelWindow;
+    unsigned int window_bits = window_bits_;
+    if (profile_ != nullptr) {
+      const PippengerProfile::Entry* entry = profile_->Find(
+          PippengerProfile::GetCurveKey<PointTy>(),
+          std::distance(bases_first, bases_last),
+          Pippenger<PointTy>::GetThreadNums());
+      if (entry != nullptr) {
+        strategy = entry->strategy;
+        if (window_bits == 0) window_bits = entry->window_bits;
+      }
+    }
+    return RunInternal(std::move(bases_first), std::move(bases_last),
+                       std::move(scalars_first), std::move(scalars_last),
+                       strategy, window_bits, ret);
   }
 
   template <typename BaseInputIterator, typename ScalarInputIterator>
@@ -37,71 +76,51 @@ class PippengerAdapter {
                        ScalarInputIterator scalars_first,
                        ScalarInputIterator scalars_last,
                        PippengerParallelStrategy strategy, Bucket* ret) {
-    if (strategy == PippengerParallelStrategy::kNone ||
-        strategy == PippengerParallelStrategy::kParallelWindow) {
-      Pippenger<PointTy> pippenger;
-      pippenger.SetParallelWindows(strategy ==
-                                   PippengerParallelStrategy::kParallelWindow);
-      return pippenger.Run(std::move(bases_first), std::move(bases_last),
-                           std::move(scalars_first), std::move(scalars_last),
-                           ret);
-    } else {
-      size_t bases_size = std::distance(bases_first, bases_last);
-      size_t scalars_size = std::distance(scalars_first, scalars_last);
-      if (bases_size != scalars_size) {
-        LOG(ERROR) << "bases_size and scalars_size don't match";
-        return false;
-      }
-
-#if defined(TACHYON_HAS_OPENMP)
-      int thread_nums = omp_get_max_threads();
-      if (strategy == PippengerParallelStrategy::kParallelWindowAndTerm) {
-        size_t window_bits = PippengerCtx::ComputeWindowsBits(scalars_size);
-        size_t window_size =
-            PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits);
-        thread_nums = std::max(thread_nums / static_cast<int>(window_size), 2);
-      }
-#else
-      int thread_nums = 1;
-#endif  // defined(TACHYON_HAS_OPENMP)
-      struct Result {
-        Bucket value;
-        bool valid;
-      };
-
-      std::vector<Result> results;
-      results.resize(thread_nums);
-      size_t size = (scalars_size + thread_nums - 1) / thread_nums;
-#if defined(TACHYON_HAS_OPENMP)
-      omp_set_num_threads(thread_nums);
-#endif
-      OPENMP_PARALLEL_FOR(int i = 0; i < thread_nums; ++i) {
-        Pippenger<PointTy> pippenger;
-        pippenger.SetParallelWindows(
-            strategy == PippengerParallelStrategy::kParallelWindowAndTerm);
-        auto bases_start = bases_first + size * i;
-        auto bases_end =
-            i == thread_nums - 1 ? bases_last : bases_first + size * (i + 1);
-        auto scalars_start = scalars_first + size * i;
-        auto scalars_end = i == thread_nums - 1
-                               ? scalars_last
-                               : scalars_first + size * (i + 1);
-        results[i].valid = pippenger.Run(bases_start, bases_end, scalars_start,
-                                         scalars_end, &results[i].value);
-      }
-
-      bool all_good =
-          std::all_of(results.begin(), results.end(),
-                      [](const Result& result) { return result.valid; });
-      if (!all_good) return false;
+    return RunInternal(std::move(bases_first), std::move(bases_last),
+                       std::move(scalars_first), std::move(scalars_last),
+                       strategy, window_bits_, ret);
+  }
 
-      *ret = std::accumulate(results.begin(), results.end(), Bucket::Zero(),
-                             [](const Bucket& total, const Result& result) {
-                               return total + result.value;
-                             });
-      return true;
+ private:
+  // Every strategy runs on a single |Pippenger| with as many threads as
+  // OpenMP does. The strategies which split the terms run the windows as a
+  // grid of (window, chunk) tasks rather than as nested MSMs over chunks, so
+  // that the number of threads in use doesn't have to be changed.
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  bool RunInternal(BaseInputIterator bases_first, BaseInputIterator bases_last,
+                   ScalarInputIterator scalars_first,
+                   ScalarInputIterator scalars_last,
+                   PippengerParallelStrategy strategy, unsigned int window_bits,
+                   Bucket* ret) {
+    Pippenger<PointTy> pippenger;
+    pippenger.SetParallelWindows(strategy != PippengerParallelStrategy::kNone);
+    pippenger.SetUseBatchAffine(use_batch_affine_);
+    pippenger.SetUseBucketSort(use_bucket_sort_);
+    pippenger.SetWindowBits(window_bits);
+    pippenger.SetStats(stats_);
+    switch (strategy) {
+      case PippengerParallelStrategy::kNone:
+      case PippengerParallelStrategy::kParallelWindow:
+        break;
+      case PippengerParallelStrategy::kParallelTerm:
+        // Every window is split over all threads.
+        pippenger.SetChunkCount(Pippenger<PointTy>::GetThreadNums());
+        break;
+      case PippengerParallelStrategy::kParallelWindowAndTerm:
+        pippenger.SetChunkCount(0);
+        break;
     }
+    return pippenger.Run(std::move(bases_first), std::move(bases_last),
+                         std::move(scalars_first), std::move(scalars_last),
+                         ret);
   }
+
+  bool use_batch_affine_ = Pippenger<PointTy>::kUseBatchAffineByDefault;
+  bool use_bucket_sort_ = false;
+  unsigned int window_bits_ = 0;
+  const PippengerProfile* profile_ = &PippengerProfile::GetDefault();
+  // not owned
+  MSMStats* stats_ = nullptr;
 };
 
 }  // namespace tachyon::math
@@ -6,7 +6,8 @@
 namespace tachyon::math {
 
 template <typename PointTy, bool IsRandom,
-          enum PippengerParallelStrategy Strategy>
+          enum PippengerParallelStrategy Strategy, bool UseBatchAffine = false,
+          bool UseBucketSort = false>
 void BM_PippengerAdapter(benchmark::State& state) {
   PointTy::Curve::Init();
   MSMTestSet<PointTy> test_set;
@@ -17,6 +18,8 @@ void BM_PippengerAdapter(benchmark::State& state) {
         MSMTestSet<PointTy>::NonUniform(state.range(0), 10, MSMMethod::kNone);
   }
   PippengerAdapter<PointTy> pippenger;
+  pippenger.SetUseBatchAffine(UseBatchAffine);
+  pippenger.SetUseBucketSort(UseBucketSort);
   using Bucket = typename PippengerAdapter<PointTy>::Bucket;
   Bucket ret;
   for (auto _ : state) {
@@ -65,6 +68,35 @@ void BM_PippengerAdapterNonUniformWithParallelWindowAndTerm(
                       PippengerParallelStrategy::kParallelWindowAndTerm>(state);
 }
 
+template <typename PointTy>
+void BM_PippengerAdapterRandomWithParallelWindowAndBatchAffine(
+    benchmark::State& state) {
+  BM_PippengerAdapter<PointTy, true, PippengerParallelStrategy::kParallelWindow,
+                      true>(state);
+}
+
+template <typename PointTy>
+void BM_PippengerAdapterNonUniformWithParallelWindowAndBatchAffine(
+    benchmark::State& state) {
+  BM_PippengerAdapter<PointTy, false,
+                      PippengerParallelStrategy::kParallelWindow, true>(state);
+}
+
+template <typename PointTy>
+void BM_PippengerAdapterRandomWithParallelWindowAndBucketSort(
+    benchmark::State& state) {
+  BM_PippengerAdapter<PointTy, true, PippengerParallelStrategy::kParallelWindow,
+                      false, true>(state);
+}
+
+template <typename PointTy>
+void BM_PippengerAdapterNonUniformWithParallelWindowAndBucketSort(
+    benchmark::State& state) {
+  BM_PippengerAdapter<PointTy, false,
+                      PippengerParallelStrategy::kParallelWindow, false,
+                      true>(state);
+}
+
 BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelWindow,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
@@ -73,6 +105,24 @@ BENCHMARK_TEMPLATE(BM_PippengerAdapterNonUniformWithParallelWindow,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelWindowAndBatchAffine,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(
+    BM_PippengerAdapterNonUniformWithParallelWindowAndBatchAffine,
+    bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelWindowAndBucketSort,
+                   bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(
+    BM_PippengerAdapterNonUniformWithParallelWindowAndBucketSort,
+    bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
 BENCHMARK_TEMPLATE(BM_PippengerAdapterRandomWithParallelTerm,
                    bn254::G1AffinePoint)
     ->RangeMultiplier(2)
@@ -36,14 +36,44 @@ TEST_F(PippengerAdapterTest, RunWithStrategy) {
         PippengerParallelStrategy::kParallelWindow,
         PippengerParallelStrategy::kParallelTerm,
         PippengerParallelStrategy::kParallelWindowAndTerm}) {
-    PippengerAdapter<bn254::G1AffinePoint> pippenger;
-    SCOPED_TRACE(absl::Substitute("strategy: $0", static_cast<int>(strategy)));
-    bn254::G1PointXYZZ ret;
-    EXPECT_TRUE(pippenger.RunWithStrategy(
-        test_set.bases.begin(), test_set.bases.end(), test_set.scalars.begin(),
-        test_set.scalars.end(), strategy, &ret));
-    EXPECT_EQ(ret, test_set.answer);
+    for (bool use_batch_affine : {false, true}) {
+      PippengerAdapter<bn254::G1AffinePoint> pippenger;
+      SCOPED_TRACE(absl::Substitute("strategy: $0 use_batch_affine: $1",
+                                    static_cast<int>(strategy),
+                                    use_batch_affine));
+      pippenger.SetUseBatchAffine(use_batch_affine);
+      bn254::G1PointXYZZ ret;
+      EXPECT_TRUE(pippenger.RunWithStrategy(
+          test_set.bases.begin(), test_set.bases.end(),
+          test_set.scalars.begin(), test_set.scalars.end(), strategy, &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
   }
 }
 
+TEST_F(PippengerAdapterTest, RunWithProfile) {
+  const MSMTestSet<bn254::G1AffinePoint>& test_set = this->test_set_;
+
+  PippengerProfile profile;
+  PippengerProfile::Entry entry;
+  entry.curve = PippengerProfile::GetCurveKey<bn254::G1AffinePoint>();
+  entry.log_size = 10;
+#if defined(TACHYON_HAS_OPENMP)
+  entry.thread_nums = omp_get_max_threads();
+#else
+  entry.thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+  entry.window_bits = 4;
+  entry.strategy = PippengerParallelStrategy::kParallelTerm;
+  profile.Add(entry);
+
+  PippengerAdapter<bn254::G1AffinePoint> pippenger;
+  pippenger.SetProfile(&profile);
+  bn254::G1PointXYZZ ret;
+  EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                            test_set.scalars.begin(), test_set.scalars.end(),
+                            &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
 }  // namespace tachyon::math
@@ -0,0 +1,209 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_AUTOTUNER_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_AUTOTUNER_H_
+
+#include <stddef.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/time/time.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_profile.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// PippengerAutotuner picks the window bits and the parallel strategy of
+// |PippengerAdapter| for an MSM size and a number of threads, which
+// |PippengerCtx::ComputeWindowsBits()| doesn't take into account.
+//
+// |Predict()| minimizes a cost model counted in bucket additions. A window of
+// c bits accumulates n bases into 2^(c - 1) buckets and reduces them with
+// 2^c additions, and it takes W = ⌈b / c⌉ windows for b bit scalars. The
+// windows run as W * k tasks over k chunks of bases, which T threads take in
+// ⌈W * k / T⌉ rounds:
+//
+//   cost = ⌈W * k / T⌉ * (n / k + 2^c)
+//
+// where k is 1 for kNone and kParallelWindow, T for kParallelTerm and
+// |Pippenger::ComputeChunkCount()| for kParallelWindowAndTerm, and T is 1 for
+// kNone. Additions into buckets which don't fit in the cache are penalized by
+// |kCacheMissPenalty|. |Measure()| runs the candidates around the prediction
+// and picks the fastest one, which is what |Tune()| stores in a
+// |PippengerProfile|.
+template <typename PointTy>
+class PippengerAutotuner {
+ public:
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  struct Candidate {
+    unsigned int window_bits = 0;
+    PippengerParallelStrategy strategy = PippengerParallelStrategy::kNone;
+  };
+
+  constexpr static double kCacheMissPenalty = 1.5;
+  // |Measure()| tries window bits within this distance from |Predict()|.
+  constexpr static unsigned int kMeasureWindowBitsRange = 2;
+  constexpr static unsigned int kMaxWindowBits = 24;
+
+  PippengerAutotuner()
+      : PippengerAutotuner(Pippenger<PointTy>::GetThreadNums(),
+                           GetDefaultCacheBytes()) {}
+  PippengerAutotuner(size_t thread_nums, size_t cache_bytes)
+      : thread_nums_(std::max(thread_nums, size_t{1})),
+        cache_bytes_(cache_bytes) {}
+
+  size_t thread_nums() const { return thread_nums_; }
+  size_t cache_bytes() const { return cache_bytes_; }
+
+  static size_t GetDefaultCacheBytes() {
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+    long cache_bytes = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (cache_bytes > 0) return static_cast<size_t>(cache_bytes);
+#endif  // defined(_SC_LEVEL2_CACHE_SIZE)
+    return size_t{1} << 20;
+  }
+
+  // Returns the predicted cost of |candidate| for |size| in bucket additions.
+  double ComputeCost(size_t size, const Candidate& candidate) const {
+    double n = static_cast<double>(size);
+    PippengerCtx ctx =
+        PippengerCtx::Create<ScalarField>(size, candidate.window_bits);
+    double reduction = static_cast<double>(size_t{1} << candidate.window_bits);
+    size_t bucket_bytes =
+        (size_t{1} << (candidate.window_bits - 1)) * sizeof(Bucket);
+    double penalty = bucket_bytes > cache_bytes_ ? kCacheMissPenalty : 1;
+
+    size_t thread_nums = thread_nums_;
+    size_t chunk_count = 1;
+    switch (candidate.strategy) {
+      case PippengerParallelStrategy::kNone:
+        thread_nums = 1;
+        break;
+      case PippengerParallelStrategy::kParallelWindow:
+        break;
+      case PippengerParallelStrategy::kParallelTerm:
+        chunk_count = thread_nums_;
+        break;
+      case PippengerParallelStrategy::kParallelWindowAndTerm:
+        chunk_count = Pippenger<PointTy>::ComputeChunkCount(ctx, thread_nums_);
+        break;
+    }
+    double rounds = static_cast<double>(
+        CeilDiv(ctx.window_count * chunk_count, thread_nums));
+    return rounds * (n / chunk_count * penalty + reduction);
+  }
+
+  // Returns the candidate with the least |ComputeCost()| for |size|.
+  Candidate Predict(size_t size) const {
+    Candidate ret;
+    double best_cost = std::numeric_limits<double>::max();
+    for (PippengerParallelStrategy strategy : GetStrategies()) {
+      for (unsigned int window_bits = 1; window_bits <= kMaxWindowBits;
+           ++window_bits) {
+        Candidate candidate{window_bits, strategy};
+        double cost = ComputeCost(size, candidate);
+        if (cost < best_cost) {
+          best_cost = cost;
+          ret = candidate;
+        }
+      }
+    }
+    return ret;
+  }
+
+  // Runs the candidates around |Predict()| on pseudo random inputs of |size|
+  // and returns the fastest one. Each candidate runs |repeats| times and its
+  // fastest run counts. Note that the runs use as many threads as OpenMP
+  // does, so |thread_nums()| should match it.
+  Candidate Measure(size_t size, size_t repeats = 3) const {
+    std::vector<PointTy> bases = CreateBases(size);
+    std::vector<ScalarField> scalars =
+        base::CreateVector(size, []() { return ScalarField::Random(); });
+    return Measure(bases, scalars, repeats);
+  }
+
+  Candidate Measure(absl::Span<const PointTy> bases,
+                    absl::Span<const ScalarField> scalars,
+                    size_t repeats = 3) const {
+    Candidate predicted = Predict(bases.size());
+    unsigned int min_window_bits =
+        predicted.window_bits > kMeasureWindowBitsRange
+            ? predicted.window_bits - kMeasureWindowBitsRange
+            : 1;
+    unsigned int max_window_bits = std::min(
+        predicted.window_bits + kMeasureWindowBitsRange, kMaxWindowBits);
+
+    Candidate ret = predicted;
+    base::TimeDelta best_time = base::TimeDelta::Max();
+    for (PippengerParallelStrategy strategy : GetStrategies()) {
+      for (unsigned int window_bits = min_window_bits;
+           window_bits <= max_window_bits; ++window_bits) {
+        PippengerAdapter<PointTy> adapter;
+        adapter.SetWindowBits(window_bits);
+        for (size_t i = 0; i < repeats; ++i) {
+          Bucket result;
+          base::TimeTicks start = base::TimeTicks::Now();
+          adapter.RunWithStrategy(bases.begin(), bases.end(), scalars.begin(),
+                                  scalars.end(), strategy, &result);
+          base::TimeDelta time = base::TimeTicks::Now() - start;
+          if (time < best_time) {
+            best_time = time;
+            ret = {window_bits, strategy};
+          }
+        }
+      }
+    }
+    return ret;
+  }
+
+  // Measures the best candidate for 2^|log_size| for each of |log_sizes| and
+  // adds it to |profile|.
+  void Tune(absl::Span<const size_t> log_sizes, PippengerProfile* profile,
+            size_t repeats = 3) const {
+    for (size_t log_size : log_sizes) {
+      Candidate candidate = Measure(size_t{1} << log_size, repeats);
+      PippengerProfile::Entry entry;
+      entry.curve = PippengerProfile::GetCurveKey<PointTy>();
+      entry.log_size = log_size;
+      entry.thread_nums = thread_nums_;
+      entry.window_bits = candidate.window_bits;
+      entry.strategy = candidate.strategy;
+      profile->Add(entry);
+    }
+  }
+
+ private:
+  static size_t CeilDiv(size_t a, size_t b) { return (a + b - 1) / b; }
+
+  std::vector<PippengerParallelStrategy> GetStrategies() const {
+    if (thread_nums_ == 1) return {PippengerParallelStrategy::kNone};
+    return {PippengerParallelStrategy::kParallelWindow,
+            PippengerParallelStrategy::kParallelTerm,
+            PippengerParallelStrategy::kParallelWindowAndTerm};
+  }
+
+  // Bases don't affect the performance, so they are produced by doubling
+  // rather than by expensive |PointTy::Random()|s.
+  static std::vector<PointTy> CreateBases(size_t size) {
+    PointTy p = PointTy::Random();
+    return base::CreateVector(size, [&p]() {
+      PointTy ret = p;
+      p = ConvertPoint<PointTy>(p.Double());
+      return ret;
+    });
+  }
+
+  size_t thread_nums_;
+  size_t cache_bytes_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_AUTOTUNER_H_
@@ -0,0 +1,65 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_autotuner.h"
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::math {
+
+namespace {
+
+class PippengerAutotunerTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::G1Curve::Init(); }
+};
+
+}  // namespace
+
+TEST_F(PippengerAutotunerTest, PredictWithSingleThread) {
+  PippengerAutotuner<bn254::G1AffinePoint> autotuner(1, size_t{1} << 30);
+  for (size_t log_size : {10, 16, 20}) {
+    size_t size = size_t{1} << log_size;
+    PippengerAutotuner<bn254::G1AffinePoint>::Candidate candidate =
+        autotuner.Predict(size);
+    EXPECT_EQ(candidate.strategy, PippengerParallelStrategy::kNone);
+    // The cost model stays close to the heuristic on a single thread.
+    unsigned int window_bits = PippengerCtx::ComputeWindowsBits(size);
+    EXPECT_LE(candidate.window_bits, window_bits + 2);
+    EXPECT_GE(candidate.window_bits, window_bits - 2);
+    EXPECT_LE(autotuner.ComputeCost(size, candidate),
+              autotuner.ComputeCost(
+                  size, {window_bits, PippengerParallelStrategy::kNone}));
+  }
+}
+
+TEST_F(PippengerAutotunerTest, PredictWithManyThreads) {
+  size_t size = size_t{1} << 20;
+  PippengerAutotuner<bn254::G1AffinePoint> autotuner(64, size_t{1} << 20);
+  PippengerAutotuner<bn254::G1AffinePoint>::Candidate candidate =
+      autotuner.Predict(size);
+  EXPECT_NE(candidate.strategy, PippengerParallelStrategy::kNone);
+  // Using every thread is better than the few windows of the heuristic.
+  EXPECT_LT(autotuner.ComputeCost(size, candidate),
+            autotuner.ComputeCost(
+                size, {PippengerCtx::ComputeWindowsBits(size),
+                       PippengerParallelStrategy::kParallelWindow}));
+}
+
+TEST_F(PippengerAutotunerTest, Tune) {
+  PippengerAutotuner<bn254::G1AffinePoint> autotuner;
+  PippengerProfile profile;
+  autotuner.Tune({8}, &profile, /*repeats=*/1);
+  ASSERT_EQ(profile.entries().size(), size_t{1});
+
+  const PippengerProfile::Entry& entry = profile.entries()[0];
+  EXPECT_EQ(entry.curve,
+            PippengerProfile::GetCurveKey<bn254::G1AffinePoint>());
+  EXPECT_EQ(entry.log_size, size_t{8});
+  EXPECT_EQ(entry.thread_nums, autotuner.thread_nums());
+  unsigned int predicted = autotuner.Predict(1 << 8).window_bits;
+  EXPECT_LE(entry.window_bits,
+            predicted + PippengerAutotuner<
+                            bn254::G1AffinePoint>::kMeasureWindowBitsRange);
+}
+
+}  // namespace tachyon::math
@@ -6,9 +6,16 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_BASE_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_BASE_H_
 
+#include <stddef.h>
+
+#include <numeric>
+#include <vector>
+
 #include "absl/types/span.h"
 
+#include "tachyon/base/bits.h"
 #include "tachyon/base/containers/adapters.h"
+#include "tachyon/base/openmp_util.h"
 #include "tachyon/math/base/semigroups.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
 #include "tachyon/math/elliptic_curves/point_xyzz.h"
@@ -33,8 +40,11 @@ class PippengerBase {
  public:
   using Bucket = Bucket_;
 
+  // |BucketTy| is either |Bucket| or any point type which can be added into
+  // |Bucket|, e.g., |AffinePoint| when buckets are accumulated in affine form.
+  template <typename BucketTy>
   static Bucket AccumulateBuckets(
-      absl::Span<const Bucket> buckets,
+      absl::Span<const BucketTy> buckets,
       const Bucket& initial_value = Bucket::Zero()) {
     Bucket running_sum = Bucket::Zero();
     Bucket window_sum = initial_value;
@@ -56,6 +66,71 @@ class PippengerBase {
     return window_sum;
   }
 
+  // Same as |AccumulateBuckets()|, but the buckets are split into at most
+  // |segment_count| segments of L = 2^k buckets, whose sums are computed in
+  // parallel. The s-th segment computes its running sum Rₛ and its sum Tₛ as
+  // if it started from the first bucket. Since the buckets of the s-th segment
+  // are weighted by s * L more than that,
+  //
+  //   Σ (i + 1) * bucketᵢ = Σ Tₛ + L * Σ s * Rₛ
+  //
+  // where Σ s * Rₛ is again a sum of buckets over the running sums. When this
+  // is called within a parallel region, the segments are run as tasks, so that
+  // the threads which are done with their own work pick them up.
+  template <typename BucketTy>
+  static Bucket AccumulateBucketsInSegments(
+      absl::Span<const BucketTy> buckets, size_t segment_count,
+      const Bucket& initial_value = Bucket::Zero()) {
+    if (segment_count <= 1 || buckets.size() <= 1) {
+      return AccumulateBuckets(buckets, initial_value);
+    }
+    size_t log_segment_size = base::bits::SafeLog2Ceiling(
+        (buckets.size() + segment_count - 1) / segment_count);
+    size_t segment_size = size_t{1} << log_segment_size;
+    segment_count = (buckets.size() + segment_size - 1) / segment_size;
+
+    std::vector<Bucket> segment_sums(segment_count);
+    std::vector<Bucket> running_sums(segment_count);
+    auto accumulate_segment = [buckets, segment_size, &segment_sums,
+                               &running_sums](size_t s) {
+      absl::Span<const BucketTy> segment =
+          buckets.subspan(s * segment_size, segment_size);
+      Bucket running_sum = Bucket::Zero();
+      Bucket segment_sum = Bucket::Zero();
+      for (const auto& bucket : base::Reversed(segment)) {
+        running_sum += bucket;
+        segment_sum += running_sum;
+      }
+      running_sums[s] = std::move(running_sum);
+      segment_sums[s] = std::move(segment_sum);
+    };
+#if defined(TACHYON_HAS_OPENMP)
+    if (omp_in_parallel()) {
+#pragma omp taskloop grainsize(1)
+      for (size_t s = 0; s < segment_count; ++s) {
+        accumulate_segment(s);
+      }
+    } else {
+      OPENMP_PARALLEL_FOR(size_t s = 0; s < segment_count; ++s) {
+        accumulate_segment(s);
+      }
+    }
+#else
+    for (size_t s = 0; s < segment_count; ++s) {
+      accumulate_segment(s);
+    }
+#endif  // defined(TACHYON_HAS_OPENMP)
+
+    // L * Σ s * Rₛ
+    Bucket offset =
+        AccumulateBuckets(absl::MakeConstSpan(running_sums).subspan(1));
+    for (size_t i = 0; i < log_segment_size; ++i) {
+      offset.DoubleInPlace();
+    }
+    return std::accumulate(segment_sums.begin(), segment_sums.end(),
+                           initial_value + offset);
+  }
+
   static Bucket AccumulateWindowSums(absl::Span<const Bucket> window_sums,
                                      size_t window_bits) {
     // We store the sum for the lowest window.
@@ -0,0 +1,63 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename PointTy>
+class PippengerBaseTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint>;
+TYPED_TEST_SUITE(PippengerBaseTest, PointTypes);
+
+TYPED_TEST(PippengerBaseTest, AccumulateBucketsInSegments) {
+  using PointTy = TypeParam;
+  using Bucket = typename PippengerBase<PointTy>::Bucket;
+
+  std::vector<PointTy> buckets =
+      base::CreateVector(100, []() { return PointTy::Random(); });
+  Bucket initial_value = Bucket::Random();
+  Bucket expected = PippengerBase<PointTy>::AccumulateBuckets(
+      absl::MakeConstSpan(buckets), initial_value);
+
+  for (size_t segment_count : {1, 2, 3, 7, 100, 200}) {
+    SCOPED_TRACE(absl::Substitute("segment_count: $0", segment_count));
+    EXPECT_EQ(PippengerBase<PointTy>::AccumulateBucketsInSegments(
+                  absl::MakeConstSpan(buckets), segment_count, initial_value),
+              expected);
+  }
+}
+
+TYPED_TEST(PippengerBaseTest, AccumulateBucketsInSegmentsInParallelRegion) {
+  using PointTy = TypeParam;
+  using Bucket = typename PippengerBase<PointTy>::Bucket;
+
+  std::vector<std::vector<PointTy>> buckets_list =
+      base::CreateVector(4, []() {
+        return base::CreateVector(50, []() { return PointTy::Random(); });
+      });
+  std::vector<Bucket> rets(buckets_list.size());
+  OPENMP_PARALLEL_FOR(size_t i = 0; i < buckets_list.size(); ++i) {
+    rets[i] = PippengerBase<PointTy>::AccumulateBucketsInSegments(
+        absl::MakeConstSpan(buckets_list[i]), 4);
+  }
+  for (size_t i = 0; i < buckets_list.size(); ++i) {
+    EXPECT_EQ(rets[i], PippengerBase<PointTy>::AccumulateBuckets(
+                           absl::MakeConstSpan(buckets_list[i])));
+  }
+}
+
+}  // namespace tachyon::math
@@ -1,6 +1,7 @@
 #include "benchmark/benchmark.h"
 
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
 
 namespace tachyon::math {
@@ -41,6 +42,12 @@ BENCHMARK_TEMPLATE(BM_PippengerRandom, bn254::G1AffinePoint)
 BENCHMARK_TEMPLATE(BM_PippengerNonUniform, bn254::G1AffinePoint)
     ->RangeMultiplier(2)
     ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerRandom, bn254::G2AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
+BENCHMARK_TEMPLATE(BM_PippengerNonUniform, bn254::G2AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(1 << 15, 1 << 20);
 
 }  // namespace tachyon::math
 
@@ -18,9 +18,14 @@ struct TACHYON_EXPORT PippengerCtx {
 
   template <typename ScalarField>
   constexpr static PippengerCtx CreateDefault(size_t size) {
+    return Create<ScalarField>(size, ComputeWindowsBits(size));
+  }
+
+  template <typename ScalarField>
+  constexpr static PippengerCtx Create(size_t size, unsigned int window_bits) {
     PippengerCtx ctx;
-    ctx.window_bits = ComputeWindowsBits(size);
-    ctx.window_count = ComputeWindowsCount<ScalarField>(ctx.window_bits);
+    ctx.window_bits = window_bits;
+    ctx.window_count = ComputeWindowsCount<ScalarField>(window_bits);
     ctx.size = size;
     return ctx;
   }
@@ -0,0 +1,167 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_profile.h"
+
+#include <stdint.h>
+
+#include "absl/strings/ascii.h"
+#include "absl/strings/str_join.h"
+#include "absl/strings/str_split.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/environment.h"
+#include "tachyon/base/files/file_util.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/no_destructor.h"
+#include "tachyon/base/strings/string_number_conversions.h"
+#include "tachyon/base/strings/string_util.h"
+
+namespace tachyon::math {
+
+namespace {
+
+constexpr std::string_view kHeader =
+    "# curve log_size thread_nums window_bits strategy";
+
+PippengerProfile LoadDefaultProfile() {
+  PippengerProfile profile;
+  std::string_view path;
+  if (!base::Environment::Get(PippengerProfile::kPathEnvName, &path)) {
+    return profile;
+  }
+  if (!profile.Load(base::FilePath(path))) {
+    LOG(ERROR) << "Failed to load pippenger profile: " << path;
+    return PippengerProfile();
+  }
+  return profile;
+}
+
+bool ParseEntry(std::string_view line, PippengerProfile::Entry* entry) {
+  std::vector<std::string_view> fields =
+      absl::StrSplit(line, ' ', absl::SkipWhitespace());
+  if (fields.size() != 5) return false;
+  unsigned int window_bits;
+  if (!base::StringToSizeT(fields[1], &entry->log_size)) return false;
+  if (!base::StringToSizeT(fields[2], &entry->thread_nums)) return false;
+  if (!base::StringToUint(fields[3], &window_bits)) return false;
+  if (window_bits == 0) return false;
+  if (window_bits > PippengerProfile::kMaxWindowBits) {
+    LOG(ERROR) << "Window bits " << window_bits << " exceed the maximum "
+               << PippengerProfile::kMaxWindowBits;
+    return false;
+  }
+  if (!PippengerParallelStrategyFromString(fields[4], &entry->strategy)) {
+    return false;
+  }
+  entry->curve = std::string(fields[0]);
+  entry->window_bits = window_bits;
+  return true;
+}
+
+}  // namespace
+
+std::string_view PippengerParallelStrategyToString(
+    PippengerParallelStrategy strategy) {
+  switch (strategy) {
+    case PippengerParallelStrategy::kNone:
+      return "none";
+    case PippengerParallelStrategy::kParallelWindow:
+      return "parallel_window";
+    case PippengerParallelStrategy::kParallelTerm:
+      return "parallel_term";
+    case PippengerParallelStrategy::kParallelWindowAndTerm:
+      return "parallel_window_and_term";
+  }
+  NOTREACHED();
+  return "";
+}
+
+bool PippengerParallelStrategyFromString(std::string_view str,
+                                         PippengerParallelStrategy* strategy) {
+  for (PippengerParallelStrategy candidate :
+       {PippengerParallelStrategy::kNone,
+        PippengerParallelStrategy::kParallelWindow,
+        PippengerParallelStrategy::kParallelTerm,
+        PippengerParallelStrategy::kParallelWindowAndTerm}) {
+    if (str == PippengerParallelStrategyToString(candidate)) {
+      *strategy = candidate;
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string PippengerProfile::Entry::ToString() const {
+  return absl::Substitute("$0 $1 $2 $3 $4", curve, log_size, thread_nums,
+                          window_bits,
+                          PippengerParallelStrategyToString(strategy));
+}
+
+// static
+const PippengerProfile& PippengerProfile::GetDefault() {
+  static base::NoDestructor<PippengerProfile> profile(LoadDefaultProfile());
+  return *profile;
+}
+
+void PippengerProfile::Add(const Entry& entry) {
+  for (Entry& e : entries_) {
+    if (e.curve == entry.curve && e.log_size == entry.log_size &&
+        e.thread_nums == entry.thread_nums) {
+      e = entry;
+      return;
+    }
+  }
+  entries_.push_back(entry);
+}
+
+const PippengerProfile::Entry* PippengerProfile::Find(
+    std::string_view curve, size_t size, size_t thread_nums) const {
+  size_t log_size =
+      size <= 1 ? 0 : static_cast<size_t>(base::bits::Log2Ceiling(size));
+  const Entry* ret = nullptr;
+  size_t best_distance = kMaxLogSizeDistance + 1;
+  for (const Entry& entry : entries_) {
+    if (entry.curve != curve || entry.thread_nums != thread_nums) continue;
+    size_t distance = entry.log_size > log_size ? entry.log_size - log_size
+                                                : log_size - entry.log_size;
+    if (distance < best_distance) {
+      best_distance = distance;
+      ret = &entry;
+    }
+  }
+  return ret;
+}
+
+bool PippengerProfile::Load(const base::FilePath& path) {
+  std::string content;
+  if (!base::ReadFileToString(path, &content)) return false;
+  return FromString(content);
+}
+
+bool PippengerProfile::Save(const base::FilePath& path) const {
+  return base::WriteFile(path, ToString());
+}
+
+bool PippengerProfile::FromString(std::string_view str) {
+  std::vector<Entry> entries;
+  for (std::string_view line : absl::StrSplit(str, '\n')) {
+    line = absl::StripAsciiWhitespace(line);
+    if (line.empty() || base::StartsWith(line, "#")) continue;
+    Entry entry;
+    if (!ParseEntry(line, &entry)) {
+      LOG(ERROR) << "Invalid pippenger profile entry: " << line;
+      return false;
+    }
+    entries.push_back(std::move(entry));
+  }
+  entries_ = std::move(entries);
+  return true;
+}
+
+std::string PippengerProfile::ToString() const {
+  std::vector<std::string> lines = {std::string(kHeader)};
+  for (const Entry& entry : entries_) {
+    lines.push_back(entry.ToString());
+  }
+  return absl::StrJoin(lines, "\n") + "\n";
+}
+
+}  // namespace tachyon::math
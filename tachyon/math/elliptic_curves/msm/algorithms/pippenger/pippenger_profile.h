@@ -0,0 +1,108 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_PROFILE_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_PROFILE_H_
+
+#include <stddef.h>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/export.h"
+
+namespace tachyon::math {
+
+enum class PippengerParallelStrategy {
+  kNone,
+  kParallelWindow,
+  kParallelTerm,
+  kParallelWindowAndTerm,
+};
+
+TACHYON_EXPORT std::string_view PippengerParallelStrategyToString(
+    PippengerParallelStrategy strategy);
+
+TACHYON_EXPORT bool PippengerParallelStrategyFromString(
+    std::string_view str, PippengerParallelStrategy* strategy);
+
+// PippengerProfile keeps the window bits and the parallel strategy which run
+// the fastest for a curve, an MSM size and a number of threads. It is usually
+// filled by |PippengerAutotuner| and saved to a text file with a line per
+// entry:
+//
+//   # curve log_size thread_nums window_bits strategy
+//   fr254_fq256 16 64 5 parallel_window
+//
+// |PippengerAdapter| uses the profile at $TACHYON_PIPPENGER_PROFILE, which is
+// loaded once when it is needed for the first time.
+class TACHYON_EXPORT PippengerProfile {
+ public:
+  constexpr static std::string_view kPathEnvName = "TACHYON_PIPPENGER_PROFILE";
+  // The same as |Pippenger::kMaxWindowBits|. An entry with larger window bits
+  // is rejected when it is parsed.
+  constexpr static unsigned int kMaxWindowBits = 30;
+  // |Find()| ignores an entry whose log size is farther than this from the
+  // one asked for, since the best window bits grow with the size of an MSM.
+  constexpr static size_t kMaxLogSizeDistance = 1;
+
+  struct TACHYON_EXPORT Entry {
+    // See |GetCurveKey()|.
+    std::string curve;
+    size_t log_size = 0;
+    size_t thread_nums = 0;
+    unsigned int window_bits = 0;
+    PippengerParallelStrategy strategy =
+        PippengerParallelStrategy::kParallelWindow;
+
+    bool operator==(const Entry& other) const {
+      return curve == other.curve && log_size == other.log_size &&
+             thread_nums == other.thread_nums &&
+             window_bits == other.window_bits && strategy == other.strategy;
+    }
+    bool operator!=(const Entry& other) const { return !operator==(other); }
+
+    std::string ToString() const;
+  };
+
+  // Returns the profile loaded from $TACHYON_PIPPENGER_PROFILE. It is empty
+  // when the variable is not set or the file fails to be loaded.
+  static const PippengerProfile& GetDefault();
+
+  // Returns a key which tells curves apart by what decides the cost of an
+  // MSM, the bits of a scalar and the size of a base field element, e.g.,
+  // "fr254_fq256" for bn254 G1 and "fr254_fq512" for bn254 G2.
+  template <typename PointTy>
+  static std::string GetCurveKey() {
+    return absl::Substitute(
+        "fr$0_fq$1", PointTy::ScalarField::Config::kModulusBits,
+        sizeof(typename PointTy::BaseField) * 8);
+  }
+
+  const std::vector<Entry>& entries() const { return entries_; }
+  bool empty() const { return entries_.empty(); }
+
+  // Adds |entry|. It replaces the one for the same curve, log size and
+  // number of threads if any.
+  void Add(const Entry& entry);
+
+  // Returns the entry for |curve| and |thread_nums| whose log size is the
+  // closest to log₂(|size|) within |kMaxLogSizeDistance|. Returns nullptr if
+  // there's none, in which case the defaults of |Pippenger| should be used.
+  const Entry* Find(std::string_view curve, size_t size,
+                    size_t thread_nums) const;
+
+  [[nodiscard]] bool Load(const base::FilePath& path);
+  [[nodiscard]] bool Save(const base::FilePath& path) const;
+
+  [[nodiscard]] bool FromString(std::string_view str);
+  std::string ToString() const;
+
+ private:
+  std::vector<Entry> entries_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_PIPPENGER_PROFILE_H_
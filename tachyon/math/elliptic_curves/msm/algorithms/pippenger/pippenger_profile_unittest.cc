@@ -0,0 +1,125 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_profile.h"
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/scoped_temp_dir.h"
+
+namespace tachyon::math {
+
+namespace {
+
+PippengerProfile::Entry CreateEntry(std::string_view curve, size_t log_size,
+                                    size_t thread_nums,
+                                    unsigned int window_bits,
+                                    PippengerParallelStrategy strategy) {
+  PippengerProfile::Entry entry;
+  entry.curve = std::string(curve);
+  entry.log_size = log_size;
+  entry.thread_nums = thread_nums;
+  entry.window_bits = window_bits;
+  entry.strategy = strategy;
+  return entry;
+}
+
+}  // namespace
+
+TEST(PippengerProfileTest, ParallelStrategyConversions) {
+  for (PippengerParallelStrategy strategy :
+       {PippengerParallelStrategy::kNone,
+        PippengerParallelStrategy::kParallelWindow,
+        PippengerParallelStrategy::kParallelTerm,
+        PippengerParallelStrategy::kParallelWindowAndTerm}) {
+    PippengerParallelStrategy parsed;
+    ASSERT_TRUE(PippengerParallelStrategyFromString(
+        PippengerParallelStrategyToString(strategy), &parsed));
+    EXPECT_EQ(parsed, strategy);
+  }
+  PippengerParallelStrategy parsed;
+  EXPECT_FALSE(PippengerParallelStrategyFromString("parallel", &parsed));
+}
+
+TEST(PippengerProfileTest, AddAndFind) {
+  PippengerProfile profile;
+  profile.Add(CreateEntry("a", 10, 8, 7, PippengerParallelStrategy::kNone));
+  profile.Add(CreateEntry("a", 16, 8, 9,
+                          PippengerParallelStrategy::kParallelWindow));
+  profile.Add(
+      CreateEntry("a", 16, 64, 5, PippengerParallelStrategy::kParallelTerm));
+  profile.Add(CreateEntry("b", 16, 8, 11, PippengerParallelStrategy::kNone));
+  // Replaces the second one.
+  profile.Add(CreateEntry("a", 16, 8, 10,
+                          PippengerParallelStrategy::kParallelWindow));
+  EXPECT_EQ(profile.entries().size(), size_t{4});
+
+  const PippengerProfile::Entry* entry = profile.Find("a", 1 << 16, 8);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->window_bits, 10u);
+  // The closest log size is picked.
+  entry = profile.Find("a", 1 << 11, 8);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->log_size, size_t{10});
+  entry = profile.Find("a", 1 << 17, 64);
+  ASSERT_NE(entry, nullptr);
+  EXPECT_EQ(entry->strategy, PippengerParallelStrategy::kParallelTerm);
+
+  EXPECT_EQ(profile.Find("a", 1 << 16, 16), nullptr);
+  EXPECT_EQ(profile.Find("c", 1 << 16, 8), nullptr);
+}
+
+TEST(PippengerProfileTest, FindIgnoresFarSizes) {
+  PippengerProfile profile;
+  profile.Add(CreateEntry("a", 20, 8, 15,
+                          PippengerParallelStrategy::kParallelWindow));
+
+  // An entry tuned for 2²⁰ must not force its window bits on much smaller
+  // MSMs, which are left to the defaults.
+  for (size_t log_size : {8, 12, 18, 22}) {
+    SCOPED_TRACE(absl::Substitute("log_size: $0", log_size));
+    EXPECT_EQ(profile.Find("a", size_t{1} << log_size, 8), nullptr);
+  }
+  for (size_t log_size : {19, 20, 21}) {
+    SCOPED_TRACE(absl::Substitute("log_size: $0", log_size));
+    const PippengerProfile::Entry* entry =
+        profile.Find("a", size_t{1} << log_size, 8);
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->window_bits, 15u);
+  }
+}
+
+TEST(PippengerProfileTest, SaveAndLoad) {
+  PippengerProfile profile;
+  profile.Add(CreateEntry("fr254_fq256", 16, 8, 9,
+                          PippengerParallelStrategy::kParallelWindow));
+  profile.Add(CreateEntry("fr254_fq256", 20, 8, 12,
+                          PippengerParallelStrategy::kParallelWindowAndTerm));
+
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("pippenger_profile.txt");
+  ASSERT_TRUE(profile.Save(path));
+
+  PippengerProfile loaded;
+  ASSERT_TRUE(loaded.Load(path));
+  EXPECT_EQ(loaded.entries(), profile.entries());
+}
+
+TEST(PippengerProfileTest, FromString) {
+  PippengerProfile profile;
+  EXPECT_TRUE(profile.FromString(
+      "# comment\n\n  fr254_fq256 16 8 9 parallel_window  \n"));
+  ASSERT_EQ(profile.entries().size(), size_t{1});
+  EXPECT_EQ(profile.entries()[0],
+            CreateEntry("fr254_fq256", 16, 8, 9,
+                        PippengerParallelStrategy::kParallelWindow));
+
+  EXPECT_FALSE(profile.FromString("fr254_fq256 16 8 9\n"));
+  EXPECT_FALSE(profile.FromString("fr254_fq256 16 8 0 none\n"));
+  EXPECT_FALSE(profile.FromString(absl::Substitute(
+      "fr254_fq256 16 8 $0 none\n", PippengerProfile::kMaxWindowBits + 1)));
+  EXPECT_FALSE(profile.FromString("fr254_fq256 16 x 9 none\n"));
+  // A failed parse keeps the previous entries.
+  EXPECT_EQ(profile.entries().size(), size_t{1});
+}
+
+}  // namespace tachyon::math
@@ -1,9 +1,13 @@
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
 
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g2.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
 
 namespace tachyon::math {
@@ -33,7 +37,8 @@ using PointTypes =
     testing::Types<bn254::G1AffinePoint, bn254::G1ProjectivePoint,
                    bn254::G1JacobianPoint, bn254::G1PointXYZZ,
                    // See https://github.com/kroma-network/tachyon/pull/31
-                   bls12_381::G1AffinePoint>;
+                   bls12_381::G1AffinePoint, bn254::G2AffinePoint,
+                   bn254::G2JacobianPoint, bls12_381::G2AffinePoint>;
 TYPED_TEST_SUITE(PippengerTest, PointTypes);
 
 TYPED_TEST(PippengerTest, Run) {
@@ -68,4 +73,152 @@ TYPED_TEST(PippengerTest, Run) {
   }
 }
 
+TYPED_TEST(PippengerTest, RunWithBucketSort) {
+  using PointTy = TypeParam;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  for (const MSMTestSet<PointTy>& test_set :
+       {this->test_set_, MSMTestSet<PointTy>::Easy(kSize, MSMMethod::kNaive)}) {
+    for (bool parallel_windows : {false, true}) {
+      Pippenger<PointTy> pippenger;
+      pippenger.SetUseMSMWindowNAForTesting(true);
+      pippenger.SetUseBucketSort(true);
+      pippenger.SetParallelWindows(parallel_windows);
+      Bucket ret;
+      EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                test_set.scalars.begin(),
+                                test_set.scalars.end(), &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
+TYPED_TEST(PippengerTest, BatchAffineAndBucketSortAreExclusive) {
+  using PointTy = TypeParam;
+
+  Pippenger<PointTy> pippenger;
+  EXPECT_EQ(pippenger.use_batch_affine(),
+            Pippenger<PointTy>::kUseBatchAffineByDefault);
+  // Bucket sort disables batch affine even where it's on by default.
+  pippenger.SetUseBucketSort(true);
+  EXPECT_TRUE(pippenger.use_bucket_sort());
+  EXPECT_FALSE(pippenger.use_batch_affine());
+  if constexpr (Pippenger<PointTy>::kCanUseBatchAffine) {
+    pippenger.SetUseBatchAffine(true);
+    EXPECT_TRUE(pippenger.use_batch_affine());
+    EXPECT_FALSE(pippenger.use_bucket_sort());
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithChunks) {
+  using PointTy = TypeParam;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  for (bool use_window_naf : {false, true}) {
+    for (bool parallel_windows : {false, true}) {
+      // 0 picks the count and |kSize| + 1 is more chunks than bases.
+      for (size_t chunk_count : {size_t{0}, size_t{3}, kSize + 1}) {
+        SCOPED_TRACE(absl::Substitute(
+            "use_window_naf: $0 parallel_windows: $1 chunk_count: $2",
+            use_window_naf, parallel_windows, chunk_count));
+        Pippenger<PointTy> pippenger;
+        pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+        pippenger.SetParallelWindows(parallel_windows);
+        pippenger.SetChunkCount(chunk_count);
+        Bucket ret;
+        EXPECT_TRUE(pippenger.Run(
+            test_set.bases.begin(), test_set.bases.end(),
+            test_set.scalars.begin(), test_set.scalars.end(), &ret));
+        EXPECT_EQ(ret, test_set.answer);
+      }
+    }
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithLargeWindows) {
+  using PointTy = TypeParam;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  // The buckets of the windows are reduced in segments with more than one
+  // thread.
+  for (bool use_window_naf : {false, true}) {
+    Pippenger<PointTy> pippenger;
+    pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+    pippenger.SetWindowBits(13);
+    Bucket ret;
+    EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                              test_set.scalars.begin(), test_set.scalars.end(),
+                              &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(PippengerTest, ComputeChunkCount) {
+  using PointTy = TypeParam;
+  using ScalarField = typename PointTy::ScalarField;
+
+  PippengerCtx ctx = PippengerCtx::Create<ScalarField>(size_t{1} << 20, 16);
+  // 16 windows are split into 4 chunks to give 4 tasks to each of 16 threads.
+  EXPECT_EQ(Pippenger<PointTy>::ComputeChunkCount(ctx, 16), size_t{4});
+  // No more chunks than the windows need to be given a task per thread.
+  EXPECT_EQ(Pippenger<PointTy>::ComputeChunkCount(ctx, 1), size_t{1});
+  // A chunk isn't made smaller than the buckets.
+  EXPECT_EQ(Pippenger<PointTy>::ComputeChunkCount(ctx, 1024), size_t{16});
+}
+
+TYPED_TEST(PippengerTest, RunWithBatchAffine) {
+  using PointTy = TypeParam;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  if constexpr (Pippenger<PointTy>::kCanUseBatchAffine) {
+    // |MSMTestSet::Easy()| uses the same base everywhere, which makes buckets
+    // hit doublings and cancellations.
+    for (const MSMTestSet<PointTy>& test_set :
+         {this->test_set_,
+          MSMTestSet<PointTy>::Easy(kSize, MSMMethod::kNaive)}) {
+      Pippenger<PointTy> pippenger;
+      pippenger.SetUseMSMWindowNAForTesting(true);
+      pippenger.SetUseBatchAffine(true);
+      Bucket ret;
+      EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                                test_set.scalars.begin(),
+                                test_set.scalars.end(), &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  } else {
+    GTEST_SKIP() << "Batch affine needs affine bases";
+  }
+}
+
+TYPED_TEST(PippengerTest, RunWithStats) {
+  using PointTy = TypeParam;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  for (bool use_window_naf : {false, true}) {
+    SCOPED_TRACE(absl::Substitute("use_window_naf: $0", use_window_naf));
+    Pippenger<PointTy> pippenger;
+    pippenger.SetUseMSMWindowNAForTesting(use_window_naf);
+    MSMStats stats;
+    pippenger.SetStats(&stats);
+    Bucket ret;
+    EXPECT_TRUE(pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                              test_set.scalars.begin(), test_set.scalars.end(),
+                              &ret));
+    EXPECT_EQ(ret, test_set.answer);
+    if constexpr (MSMStats::kEnabled) {
+      EXPECT_GT(stats.GetBucketNums(), 0);
+      EXPECT_LT(stats.bucket_occupancy[0], stats.GetBucketNums());
+    } else {
+      EXPECT_EQ(stats.GetBucketNums(), 0);
+      EXPECT_EQ(stats.GetTotalTime(), base::TimeDelta());
+    }
+  }
+}
+
 }  // namespace tachyon::math
@@ -0,0 +1,130 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_WINDOW_DIGITS_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_WINDOW_DIGITS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+
+// Fills |digits_size| signed digits of |scalar| into |digits|, each of which
+// is |stride| apart from the previous one.
+// From:
+// https://github.com/arkworks-rs/gemini/blob/main/src/kzg/msm/variable_base.rs#L20
+template <size_t N, typename Digit>
+void FillDigits(const BigInt<N>& scalar, size_t window_bits, Digit* digits,
+                size_t digits_size, size_t stride = 1) {
+  uint64_t radix = 1 << window_bits;
+
+  uint64_t carry = 0;
+  size_t bit_offset = 0;
+  for (size_t i = 0; i < digits_size; ++i) {
+    // Construct a buffer of bits of the |scalar|, starting at
+    // `bit_offset`.
+    uint64_t bits = scalar.ExtractBits64(bit_offset, window_bits);
+
+    // Read the actual coefficient value from the window
+    uint64_t coeff = carry + bits;  // coeff = [0, 2^|window_bits|)
+
+    // Recenter coefficients from [0,2^|window_bits|) to
+    // [-2^|window_bits|/2, 2^|window_bits|/2)
+    carry = (coeff + radix / 2) >> window_bits;
+    digits[i * stride] = static_cast<Digit>(
+        static_cast<int64_t>(coeff) -
+        static_cast<int64_t>(carry << window_bits));
+    bit_offset += window_bits;
+  }
+
+  digits[(digits_size - 1) * stride] +=
+      static_cast<Digit>(carry << window_bits);
+}
+
+template <size_t N>
+void FillDigits(const BigInt<N>& scalar, size_t window_bits,
+                std::vector<int64_t>* digits) {
+  FillDigits(scalar, window_bits, digits->data(), digits->size());
+}
+
+// WindowDigits holds the signed digits of every scalar in a single buffer laid
+// out window by window, so that the thread accumulating a window reads a
+// dense stream instead of chasing a vector per scalar. A digit of the last
+// window can be as large as 2^|window_bits|, which decides |Digit|. See
+// |CanHoldDigits()|.
+template <typename Digit>
+class WindowDigits {
+ public:
+  // Returns true if |Digit| can hold digits of |window_bits|.
+  constexpr static bool CanHoldDigits(size_t window_bits) {
+    return window_bits + 1 < sizeof(Digit) * 8;
+  }
+
+  WindowDigits() = default;
+  WindowDigits(size_t size, size_t window_bits, size_t window_count)
+      : size_(size),
+        window_bits_(window_bits),
+        window_count_(window_count),
+        digits_(size * window_count) {
+    DCHECK(CanHoldDigits(window_bits));
+  }
+
+  // Converts scalars in [|scalars_first|, |scalars_first| + |size|) out of
+  // the montgomery form and decomposes them into digits.
+  template <typename ScalarInputIterator>
+  static WindowDigits Decompose(ScalarInputIterator scalars_first, size_t size,
+                                size_t window_bits, size_t window_count,
+                                bool parallel) {
+    WindowDigits ret(size, window_bits, window_count);
+    if (parallel) {
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+        ret.Fill(i, (scalars_first + i)->ToBigInt());
+      }
+    } else {
+      for (size_t i = 0; i < size; ++i, ++scalars_first) {
+        ret.Fill(i, scalars_first->ToBigInt());
+      }
+    }
+    return ret;
+  }
+
+  size_t size() const { return size_; }
+  size_t window_bits() const { return window_bits_; }
+  size_t window_count() const { return window_count_; }
+
+  // Returns the digits of every scalar at the |window_index|-th window.
+  absl::Span<const Digit> GetWindow(size_t window_index) const {
+    DCHECK_LT(window_index, window_count_);
+    return absl::MakeConstSpan(digits_.data() + window_index * size_, size_);
+  }
+
+  // Fills digits of |scalar| as the |index|-th scalar. If |negate| is true,
+  // digits of -|scalar| are filled instead.
+  template <size_t N>
+  void Fill(size_t index, const BigInt<N>& scalar, bool negate = false) {
+    DCHECK_LT(index, size_);
+    FillDigits(scalar, window_bits_, &digits_[index], window_count_, size_);
+    if (negate) {
+      for (size_t i = 0; i < window_count_; ++i) {
+        Digit& digit = digits_[i * size_ + index];
+        digit = -digit;
+      }
+    }
+  }
+
+ private:
+  size_t size_ = 0;
+  size_t window_bits_ = 0;
+  size_t window_count_ = 0;
+  // |digits_[i * size_ + j]| is the i-th digit of the j-th scalar.
+  std::vector<Digit> digits_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_PIPPENGER_WINDOW_DIGITS_H_
@@ -0,0 +1,96 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/window_digits.h"
+
+#include <vector>
+
+#include "absl/strings/substitute.h"
+#include "gtest/gtest.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Digit>
+class WindowDigitsTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { bn254::Fr::Init(); }
+};
+
+}  // namespace
+
+using DigitTypes = testing::Types<int16_t, int32_t>;
+TYPED_TEST_SUITE(WindowDigitsTest, DigitTypes);
+
+TYPED_TEST(WindowDigitsTest, Decompose) {
+  using Digit = TypeParam;
+
+  const size_t kSize = 10;
+  std::vector<bn254::Fr> scalars =
+      base::CreateVector(kSize, []() { return bn254::Fr::Random(); });
+  scalars[0] = bn254::Fr::Zero();
+  scalars[1] = -bn254::Fr::One();
+
+  for (size_t window_bits : {1, 3, 8, 14}) {
+    SCOPED_TRACE(absl::Substitute("window_bits: $0", window_bits));
+    ASSERT_TRUE(WindowDigits<Digit>::CanHoldDigits(window_bits));
+    size_t window_count =
+        (bn254::Fr::Config::kModulusBits + window_bits - 1) / window_bits;
+
+    for (bool parallel : {false, true}) {
+      WindowDigits<Digit> digits = WindowDigits<Digit>::Decompose(
+          scalars.begin(), kSize, window_bits, window_count, parallel);
+      ASSERT_EQ(digits.size(), kSize);
+      ASSERT_EQ(digits.window_count(), window_count);
+
+      // s = Σᵢ dᵢ * 2^(i * |window_bits|)
+      std::vector<bn254::Fr> recovered(kSize, bn254::Fr::Zero());
+      bn254::Fr radix = bn254::Fr(uint64_t{1} << window_bits);
+      for (size_t i = window_count - 1; i != SIZE_MAX; --i) {
+        absl::Span<const Digit> window = digits.GetWindow(i);
+        for (size_t j = 0; j < kSize; ++j) {
+          int64_t digit = window[j];
+          EXPECT_LE(digit, int64_t{1} << window_bits);
+          if (i != window_count - 1) {
+            EXPECT_LT(digit, int64_t{1} << (window_bits - 1));
+            EXPECT_GE(digit, -(int64_t{1} << (window_bits - 1)));
+          }
+          recovered[j] *= radix;
+          if (digit >= 0) {
+            recovered[j] += bn254::Fr(static_cast<uint64_t>(digit));
+          } else {
+            recovered[j] -= bn254::Fr(static_cast<uint64_t>(-digit));
+          }
+        }
+      }
+      EXPECT_EQ(recovered, scalars);
+    }
+  }
+}
+
+TYPED_TEST(WindowDigitsTest, FillNegated) {
+  using Digit = TypeParam;
+
+  const size_t kWindowBits = 5;
+  const size_t kWindowCount =
+      (bn254::Fr::Config::kModulusBits + kWindowBits - 1) / kWindowBits;
+  bn254::Fr scalar = bn254::Fr::Random();
+
+  WindowDigits<Digit> digits(2, kWindowBits, kWindowCount);
+  digits.Fill(0, scalar.ToBigInt());
+  digits.Fill(1, scalar.ToBigInt(), /*negate=*/true);
+  for (size_t i = 0; i < kWindowCount; ++i) {
+    absl::Span<const Digit> window = digits.GetWindow(i);
+    EXPECT_EQ(window[1], -window[0]);
+  }
+}
+
+TEST(WindowDigitsCanHoldDigitsTest, CanHoldDigits) {
+  EXPECT_TRUE(WindowDigits<int16_t>::CanHoldDigits(14));
+  EXPECT_FALSE(WindowDigits<int16_t>::CanHoldDigits(15));
+  EXPECT_TRUE(WindowDigits<int32_t>::CanHoldDigits(30));
+  EXPECT_FALSE(WindowDigits<int32_t>::CanHoldDigits(31));
+}
+
+}  // namespace tachyon::math
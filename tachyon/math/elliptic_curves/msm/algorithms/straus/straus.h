@@ -0,0 +1,137 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_STRAUS_STRAUS_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_STRAUS_STRAUS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// Straus computes an MSM by interleaving the w-NAF double-and-add of every
+// term into a single chain of doublings:
+//
+//   1. Each base gᵢ precomputes its odd multiples gᵢ, 3gᵢ, ..., (2ʷ⁻¹ - 1)gᵢ.
+//   2. Each scalar sᵢ is converted into w-NAF digits. See |BigInt::ToWNAF()|.
+//   3. From the highest digit down, the accumulator is doubled and the odd
+//      multiple of each nonzero digit is added or subtracted.
+//
+// It takes b doublings and about n * (2ʷ⁻² + b / (w + 1)) additions for n
+// terms of b bit scalars. Unlike Pippenger, it doesn't set up and reduce
+// buckets per window, which dominates when n is small.
+template <typename PointTy>
+class Straus {
+ public:
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename PippengerTraits<PointTy>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+  constexpr static unsigned int kMinWindowBits = 2;
+  // Digits are held in int8_t. See |BigInt::ToWNAF()|.
+  constexpr static unsigned int kMaxWindowBits = 8;
+
+  // Returns the window bits which minimizes the additions of a term, the
+  // precomputation plus the nonzero digits, for |scalar_bits| bit scalars.
+  constexpr static unsigned int ComputeWindowBits(size_t scalar_bits) {
+    unsigned int ret = kMinWindowBits;
+    size_t best_cost = SIZE_MAX;
+    for (unsigned int w = kMinWindowBits; w <= kMaxWindowBits; ++w) {
+      size_t cost = (size_t{1} << (w - 2)) + scalar_bits / (w + 1);
+      if (cost < best_cost) {
+        best_cost = cost;
+        ret = w;
+      }
+    }
+    return ret;
+  }
+
+  Straus()
+      : window_bits_(ComputeWindowBits(ScalarField::Config::kModulusBits)) {}
+
+  unsigned int window_bits() const { return window_bits_; }
+
+  // |window_bits| should be in [|kMinWindowBits|, |kMaxWindowBits|].
+  void SetWindowBits(unsigned int window_bits) {
+    DCHECK_GE(window_bits, kMinWindowBits);
+    DCHECK_LE(window_bits, kMaxWindowBits);
+    window_bits_ = window_bits;
+  }
+
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  bool Run(BaseInputIterator bases_first, BaseInputIterator bases_last,
+           ScalarInputIterator scalars_first, ScalarInputIterator scalars_last,
+           Bucket* ret) const {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    if (bases_size != scalars_size) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+
+    // Zero scalars have no digits and take no table.
+    size_t table_size = size_t{1} << (window_bits_ - 2);
+    std::vector<std::vector<int8_t>> digits;
+    std::vector<Bucket> tables;
+    digits.reserve(scalars_size);
+    tables.reserve(scalars_size * table_size);
+    size_t max_digits_size = 0;
+    for (size_t i = 0; i < scalars_size; ++i) {
+      std::vector<int8_t> scalar_digits =
+          (scalars_first + i)->ToBigInt().ToWNAF(window_bits_);
+      if (scalar_digits.empty()) continue;
+      max_digits_size = std::max(max_digits_size, scalar_digits.size());
+      digits.push_back(std::move(scalar_digits));
+      AppendOddMultiples(*(bases_first + i), table_size, tables);
+    }
+
+    Bucket sum = Bucket::Zero();
+    for (size_t i = max_digits_size; i-- > 0;) {
+      sum.DoubleInPlace();
+      for (size_t j = 0; j < digits.size(); ++j) {
+        if (i >= digits[j].size()) continue;
+        int8_t digit = digits[j][i];
+        if (digit > 0) {
+          sum += tables[j * table_size + (digit >> 1)];
+        } else if (digit < 0) {
+          sum -= tables[j * table_size + ((-digit) >> 1)];
+        }
+      }
+    }
+    *ret = sum;
+    return true;
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  bool Run(const BaseContainer& bases, const ScalarContainer& scalars,
+           Bucket* ret) const {
+    return Run(std::begin(bases), std::end(bases), std::begin(scalars),
+               std::end(scalars), ret);
+  }
+
+ private:
+  // Appends g, 3g, ..., (2 * |table_size| - 1)g to |tables|.
+  static void AppendOddMultiples(const PointTy& base, size_t table_size,
+                                 std::vector<Bucket>& tables) {
+    Bucket multiple = ConvertPoint<Bucket>(base);
+    tables.push_back(multiple);
+    if (table_size == 1) return;
+    Bucket doubled = multiple.Double();
+    for (size_t i = 1; i < table_size; ++i) {
+      multiple += doubled;
+      tables.push_back(multiple);
+    }
+  }
+
+  unsigned int window_bits_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_ALGORITHMS_STRAUS_STRAUS_H_
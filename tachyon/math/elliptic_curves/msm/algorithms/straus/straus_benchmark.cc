@@ -0,0 +1,46 @@
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/straus/straus.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+template <typename PointTy>
+void BM_Straus(benchmark::State& state) {
+  PointTy::Curve::Init();
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(state.range(0), MSMMethod::kNone);
+  Straus<PointTy> straus;
+  using Bucket = typename Straus<PointTy>::Bucket;
+  Bucket ret;
+  for (auto _ : state) {
+    straus.Run(test_set.bases, test_set.scalars, &ret);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+template <typename PointTy>
+void BM_PippengerAdapter(benchmark::State& state) {
+  PointTy::Curve::Init();
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(state.range(0), MSMMethod::kNone);
+  PippengerAdapter<PointTy> pippenger;
+  using Bucket = typename PippengerAdapter<PointTy>::Bucket;
+  Bucket ret;
+  for (auto _ : state) {
+    pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                  test_set.scalars.begin(), test_set.scalars.end(), &ret);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+BENCHMARK_TEMPLATE(BM_Straus, bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(2, 256);
+BENCHMARK_TEMPLATE(BM_PippengerAdapter, bn254::G1AffinePoint)
+    ->RangeMultiplier(2)
+    ->Range(2, 256);
+
+}  // namespace tachyon::math
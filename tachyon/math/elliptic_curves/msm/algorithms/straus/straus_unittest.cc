@@ -0,0 +1,85 @@
+#include "tachyon/math/elliptic_curves/msm/algorithms/straus/straus.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename PointTy>
+class StrausTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1ProjectivePoint,
+                   bn254::G1JacobianPoint, bn254::G1PointXYZZ,
+                   bls12_381::G1AffinePoint>;
+TYPED_TEST_SUITE(StrausTest, PointTypes);
+
+TYPED_TEST(StrausTest, Run) {
+  using PointTy = TypeParam;
+  using Bucket = typename Straus<PointTy>::Bucket;
+
+  for (size_t size : {size_t{0}, size_t{1}, size_t{2}, kSize}) {
+    SCOPED_TRACE(size);
+    MSMTestSet<PointTy> test_set =
+        MSMTestSet<PointTy>::Random(size, MSMMethod::kNaive);
+
+    Straus<PointTy> straus;
+    Bucket ret;
+    ASSERT_TRUE(straus.Run(test_set.bases, test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(StrausTest, RunWithWindowBits) {
+  using PointTy = TypeParam;
+  using Bucket = typename Straus<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Sparse(kSize, MSMMethod::kNaive);
+
+  for (unsigned int window_bits = Straus<PointTy>::kMinWindowBits;
+       window_bits <= Straus<PointTy>::kMaxWindowBits; ++window_bits) {
+    SCOPED_TRACE(window_bits);
+    Straus<PointTy> straus;
+    straus.SetWindowBits(window_bits);
+    Bucket ret;
+    ASSERT_TRUE(straus.Run(test_set.bases, test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(StrausTest, RunWithMismatchedSizes) {
+  using PointTy = TypeParam;
+  using Bucket = typename Straus<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+
+  Straus<PointTy> straus;
+  Bucket ret;
+  EXPECT_FALSE(straus.Run(test_set.bases.begin(), test_set.bases.end() - 1,
+                          test_set.scalars.begin(), test_set.scalars.end(),
+                          &ret));
+}
+
+TEST(StrausWindowBitsTest, ComputeWindowBits) {
+  EXPECT_EQ(Straus<bn254::G1AffinePoint>::ComputeWindowBits(1), 2);
+  EXPECT_EQ(Straus<bn254::G1AffinePoint>::ComputeWindowBits(64), 4);
+  EXPECT_EQ(Straus<bn254::G1AffinePoint>::ComputeWindowBits(254), 5);
+}
+
+}  // namespace tachyon::math
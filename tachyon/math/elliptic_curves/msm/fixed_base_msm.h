@@ -0,0 +1,201 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon::math {
+
+// MSM(Multi-Scalar Multiplication) over bases which are known in advance:
+// s₀ * g₀ + s₁ * g₁ + ... + sₙ * gₙ
+//
+// Every scalar is split into w signed digits of c bits. For each base gᵢ, the
+// table keeps d * 2^(k * c) * gᵢ in affine form for every window k and every
+// digit magnitude d in [1, 2^(c - 1)]. Once it is built, an MSM costs at most
+// n * w mixed additions and no doublings at all. The table is
+// n * w * 2^(c - 1) affine points, so c is chosen against a memory budget.
+template <typename PointTy>
+class FixedBaseMSM {
+ public:
+  using Curve = typename PointTy::Curve;
+  using ScalarField = typename PointTy::ScalarField;
+  using AffinePointTy = AffinePoint<Curve>;
+  using JacobianPointTy = JacobianPoint<Curve>;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+  constexpr static size_t kMaxWindowBits = 12;
+  constexpr static size_t kDefaultMemoryBudget = size_t{1} << 30;  // 1 GiB
+  constexpr static size_t kPrecomputeChunkEntries = size_t{1} << 16;
+
+  FixedBaseMSM() = default;
+
+  size_t size() const { return size_; }
+  size_t window_bits() const { return window_bits_; }
+  size_t window_count() const { return window_count_; }
+  const std::vector<AffinePointTy>& table() const { return table_; }
+
+  // Returns the number of windows needed for |window_bits|. An extra bit is
+  // reserved so that the carry out of the last window never overflows it.
+  constexpr static size_t ComputeWindowCount(size_t window_bits) {
+    return (ScalarField::Config::kModulusBits + window_bits) / window_bits;
+  }
+
+  // Returns the number of bytes of a table for |bases_size| bases.
+  constexpr static size_t ComputeTableBytes(size_t bases_size,
+                                            size_t window_bits) {
+    return bases_size * ComputeWindowCount(window_bits) *
+           (size_t{1} << (window_bits - 1)) * sizeof(AffinePointTy);
+  }
+
+  // Returns the largest window bits whose table fits in |memory_budget|
+  // bytes. Returns 0 if even the smallest table doesn't fit.
+  constexpr static size_t ComputeWindowBits(size_t bases_size,
+                                            size_t memory_budget) {
+    for (size_t window_bits = kMaxWindowBits; window_bits > 0; --window_bits) {
+      if (ComputeTableBytes(bases_size, window_bits) <= memory_budget) {
+        return window_bits;
+      }
+    }
+    return 0;
+  }
+
+  // Builds the table for |bases| with the given |window_bits|.
+  template <typename BaseContainer>
+  [[nodiscard]] bool Precompute(const BaseContainer& bases,
+                                size_t window_bits) {
+    if (window_bits == 0 || window_bits > kMaxWindowBits) {
+      LOG(ERROR) << "Invalid window bits: " << window_bits;
+      return false;
+    }
+    size_ = std::size(bases);
+    window_bits_ = window_bits;
+    window_count_ = ComputeWindowCount(window_bits);
+
+    size_t row_size = GetRowSize();
+    size_t base_table_size = window_count_ * row_size;
+    table_.resize(size_ * base_table_size);
+    // The table is built in jacobian form chunk by chunk so that only a chunk
+    // of jacobian points lives at a time next to the affine table.
+    size_t chunk_size =
+        std::max(kPrecomputeChunkEntries / base_table_size, size_t{1});
+    std::vector<JacobianPointTy> jacobian_table;
+    for (size_t offset = 0; offset < size_; offset += chunk_size) {
+      size_t bases_size = std::min(chunk_size, size_ - offset);
+      jacobian_table.resize(bases_size * base_table_size);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < bases_size; ++i) {
+        JacobianPointTy* rows = &jacobian_table[i * base_table_size];
+        // 2^(k * c) * gᵢ
+        JacobianPointTy window_base =
+            ConvertPoint<JacobianPointTy>(*(std::begin(bases) + offset + i));
+        for (size_t k = 0; k < window_count_; ++k) {
+          JacobianPointTy* row = &rows[k * row_size];
+          row[0] = window_base;
+          for (size_t d = 1; d < row_size; ++d) {
+            row[d] = row[d - 1] + window_base;
+          }
+          // 2 * 2^(c - 1) * 2^(k * c) * gᵢ = 2^((k + 1) * c) * gᵢ
+          window_base = row[row_size - 1].Double();
+        }
+      }
+      absl::Span<AffinePointTy> affine_table = absl::MakeSpan(
+          &table_[offset * base_table_size], jacobian_table.size());
+      if (!JacobianPointTy::BatchToAffine(jacobian_table, &affine_table)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Builds the table for |bases| with the largest window that fits in
+  // |memory_budget| bytes.
+  template <typename BaseContainer>
+  [[nodiscard]] bool PrecomputeWithMemoryBudget(
+      const BaseContainer& bases,
+      size_t memory_budget = kDefaultMemoryBudget) {
+    size_t window_bits = ComputeWindowBits(std::size(bases), memory_budget);
+    if (window_bits == 0) {
+      LOG(ERROR) << "Memory budget is too small: " << memory_budget;
+      return false;
+    }
+    return Precompute(bases, window_bits);
+  }
+
+  // Computes the MSM over the first |std::size(scalars)| precomputed bases.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars, Bucket* ret) const {
+    size_t scalars_size = std::size(scalars);
+    if (scalars_size > size_) {
+      LOG(ERROR) << "Too many scalars: " << scalars_size << " > " << size_;
+      return false;
+    }
+
+#if defined(TACHYON_HAS_OPENMP)
+    size_t thread_nums = static_cast<size_t>(omp_get_max_threads());
+#else
+    size_t thread_nums = 1;
+#endif  // defined(TACHYON_HAS_OPENMP)
+    size_t chunk_size = (scalars_size + thread_nums - 1) / thread_nums;
+    size_t chunk_nums =
+        chunk_size == 0 ? 0 : (scalars_size + chunk_size - 1) / chunk_size;
+    std::vector<Bucket> chunk_sums(chunk_nums);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < chunk_nums; ++i) {
+      size_t begin = i * chunk_size;
+      size_t end = std::min(begin + chunk_size, scalars_size);
+      chunk_sums[i] =
+          AccumulateChunk(std::begin(scalars) + begin, begin, end - begin);
+    }
+
+    *ret = Bucket::Zero();
+    for (const Bucket& chunk_sum : chunk_sums) {
+      *ret += chunk_sum;
+    }
+    return true;
+  }
+
+ private:
+  size_t GetRowSize() const { return size_t{1} << (window_bits_ - 1); }
+
+  template <typename ScalarInputIterator>
+  Bucket AccumulateChunk(ScalarInputIterator scalars_it, size_t offset,
+                         size_t size) const {
+    size_t row_size = GetRowSize();
+    size_t base_table_size = window_count_ * row_size;
+    std::vector<int64_t> digits(window_count_);
+    Bucket sum = Bucket::Zero();
+    for (size_t i = offset; i < offset + size; ++i, ++scalars_it) {
+      FillDigits(scalars_it->ToBigInt(), window_bits_, &digits);
+      const AffinePointTy* rows = &table_[i * base_table_size];
+      for (size_t k = 0; k < window_count_; ++k) {
+        int64_t digit = digits[k];
+        if (digit > 0) {
+          sum += rows[k * row_size + static_cast<size_t>(digit - 1)];
+        } else if (digit < 0) {
+          sum -= rows[k * row_size + static_cast<size_t>(-digit - 1)];
+        }
+      }
+    }
+    return sum;
+  }
+
+  size_t size_ = 0;
+  size_t window_bits_ = 0;
+  size_t window_count_ = 0;
+  // |table_[(i * window_count_ + k) * 2^(c - 1) + d - 1]| is
+  // d * 2^(k * c) * gᵢ.
+  std::vector<AffinePointTy> table_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_FIXED_BASE_MSM_H_
@@ -0,0 +1,111 @@
+#include "tachyon/math/elliptic_curves/msm/fixed_base_msm.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename PointTy>
+class FixedBaseMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+
+  FixedBaseMSMTest()
+      : test_set_(MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNaive)) {}
+  FixedBaseMSMTest(const FixedBaseMSMTest&) = delete;
+  FixedBaseMSMTest& operator=(const FixedBaseMSMTest&) = delete;
+  ~FixedBaseMSMTest() override = default;
+
+ protected:
+  MSMTestSet<PointTy> test_set_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1ProjectivePoint,
+                   bn254::G1JacobianPoint, bn254::G1PointXYZZ>;
+TYPED_TEST_SUITE(FixedBaseMSMTest, PointTypes);
+
+TYPED_TEST(FixedBaseMSMTest, ComputeWindowBits) {
+  using PointTy = TypeParam;
+  using FixedBaseMSMTy = FixedBaseMSM<PointTy>;
+
+  for (size_t window_bits = 1; window_bits <= FixedBaseMSMTy::kMaxWindowBits;
+       ++window_bits) {
+    size_t bytes = FixedBaseMSMTy::ComputeTableBytes(kSize, window_bits);
+    EXPECT_GE(FixedBaseMSMTy::ComputeWindowBits(kSize, bytes), window_bits);
+  }
+  EXPECT_EQ(FixedBaseMSMTy::ComputeWindowBits(kSize, 0), size_t{0});
+}
+
+TYPED_TEST(FixedBaseMSMTest, Run) {
+  using PointTy = TypeParam;
+  using Bucket = typename FixedBaseMSM<PointTy>::Bucket;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  for (size_t window_bits : {1, 2, 5}) {
+    FixedBaseMSM<PointTy> msm;
+    ASSERT_TRUE(msm.Precompute(test_set.bases, window_bits));
+    EXPECT_EQ(msm.size(), kSize);
+    EXPECT_EQ(msm.window_bits(), window_bits);
+
+    Bucket ret;
+    ASSERT_TRUE(msm.Run(test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(FixedBaseMSMTest, RunWithFewerScalars) {
+  using PointTy = TypeParam;
+  using Bucket = typename FixedBaseMSM<PointTy>::Bucket;
+  using ScalarField = typename PointTy::ScalarField;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  FixedBaseMSM<PointTy> msm;
+  size_t memory_budget = FixedBaseMSM<PointTy>::ComputeTableBytes(kSize, 4);
+  ASSERT_TRUE(msm.PrecomputeWithMemoryBudget(test_set.bases, memory_budget));
+  EXPECT_EQ(msm.window_bits(), size_t{4});
+
+  std::vector<ScalarField> scalars(test_set.scalars.begin(),
+                                   test_set.scalars.begin() + kSize / 2);
+  std::vector<PointTy> bases(test_set.bases.begin(),
+                             test_set.bases.begin() + kSize / 2);
+  Bucket expected;
+  VariableBaseMSM<PointTy> variable_base_msm;
+  ASSERT_TRUE(variable_base_msm.Run(bases, scalars, &expected));
+
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(scalars, &ret));
+  EXPECT_EQ(ret, expected);
+
+  ASSERT_TRUE(msm.Run(std::vector<ScalarField>(), &ret));
+  EXPECT_EQ(ret, Bucket::Zero());
+
+  std::vector<ScalarField> too_many_scalars(kSize + 1);
+  EXPECT_FALSE(msm.Run(too_many_scalars, &ret));
+}
+
+TYPED_TEST(FixedBaseMSMTest, InvalidParams) {
+  using PointTy = TypeParam;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  FixedBaseMSM<PointTy> msm;
+  EXPECT_FALSE(msm.Precompute(test_set.bases, 0));
+  EXPECT_FALSE(msm.Precompute(test_set.bases,
+                              FixedBaseMSM<PointTy>::kMaxWindowBits + 1));
+  EXPECT_FALSE(msm.PrecomputeWithMemoryBudget(test_set.bases, 0));
+}
+
+}  // namespace tachyon::math
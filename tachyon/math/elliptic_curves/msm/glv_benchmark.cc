@@ -0,0 +1,82 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/glv.h"
+#include "tachyon/math/elliptic_curves/msm/glv_decomposition.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
+
+namespace tachyon::math {
+
+template <typename PointTy>
+void BM_GLVDecomposeGmp(benchmark::State& state) {
+  using ScalarField = typename PointTy::ScalarField;
+
+  PointTy::Curve::Init();
+  std::vector<ScalarField> scalars = base::CreateVector(
+      state.range(0), []() { return ScalarField::Random(); });
+  for (auto _ : state) {
+    for (const ScalarField& scalar : scalars) {
+      benchmark::DoNotOptimize(GLV<PointTy>::Decompose(scalar));
+    }
+  }
+}
+
+template <typename PointTy>
+void BM_GLVDecomposeNative(benchmark::State& state) {
+  using Curve = typename PointTy::Curve;
+  using ScalarField = typename PointTy::ScalarField;
+
+  Curve::Init();
+  std::vector<ScalarField> scalars = base::CreateVector(
+      state.range(0), []() { return ScalarField::Random(); });
+  for (auto _ : state) {
+    for (const ScalarField& scalar : scalars) {
+      benchmark::DoNotOptimize(GLVDecomposition<Curve>::Decompose(scalar));
+    }
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_GLVDecomposeGmp, bn254::G1AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_GLVDecomposeNative, bn254::G1AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_GLVDecomposeGmp, secp256k1::AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(BM_GLVDecomposeNative, secp256k1::AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 10, 1 << 16);
+
+}  // namespace tachyon::math
+
+// clang-format off
+// Executing tests from //tachyon/math/elliptic_curves/msm:glv_benchmark
+// -----------------------------------------------------------------------------
+// Run on (1 X Intel(R) Xeon(R) Processor)
+// CPU Caches:
+//   L2 Unified 2048 KiB (x1)
+// -----------------------------------------------------------------------------
+// Benchmark                                                    Time             CPU   Iterations
+// -----------------------------------------------------------------------------
+// BM_GLVDecomposeGmp<bn254::G1AffinePoint>/1024          1745685 ns      1732269 ns          488
+// BM_GLVDecomposeGmp<bn254::G1AffinePoint>/4096          6983442 ns      6872371 ns           82
+// BM_GLVDecomposeGmp<bn254::G1AffinePoint>/16384        28278805 ns     27883179 ns           24
+// BM_GLVDecomposeGmp<bn254::G1AffinePoint>/65536       114195311 ns    112421614 ns            6
+// BM_GLVDecomposeNative<bn254::G1AffinePoint>/1024        109092 ns       107757 ns         7185
+// BM_GLVDecomposeNative<bn254::G1AffinePoint>/4096        509521 ns       506408 ns         1000
+// BM_GLVDecomposeNative<bn254::G1AffinePoint>/16384      1730887 ns      1719681 ns          371
+// BM_GLVDecomposeNative<bn254::G1AffinePoint>/65536      8174283 ns      8085018 ns          100
+// BM_GLVDecomposeGmp<secp256k1::AffinePoint>/1024        1649871 ns      1629700 ns          500
+// BM_GLVDecomposeGmp<secp256k1::AffinePoint>/4096        6756434 ns      6580247 ns          123
+// BM_GLVDecomposeGmp<secp256k1::AffinePoint>/16384      25236190 ns     24348295 ns           24
+// BM_GLVDecomposeGmp<secp256k1::AffinePoint>/65536     113931694 ns    112607816 ns            7
+// BM_GLVDecomposeNative<secp256k1::AffinePoint>/1024      111794 ns       110473 ns         5837
+// BM_GLVDecomposeNative<secp256k1::AffinePoint>/4096      625168 ns       513760 ns         1564
+// BM_GLVDecomposeNative<secp256k1::AffinePoint>/16384    2005082 ns      1975945 ns          361
+// BM_GLVDecomposeNative<secp256k1::AffinePoint>/65536    8903157 ns      8761325 ns          102
+// clang-format on
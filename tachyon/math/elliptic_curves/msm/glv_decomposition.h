@@ -0,0 +1,108 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_DECOMPOSITION_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_DECOMPOSITION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+
+// GLVDecomposition decomposes a scalar k into k₁ + λ * k₂ with fixed width
+// integer arithmetic, unlike |GLV::Decompose()| which relies on GMP.
+//
+// Given the lattice basis [[n₁₁, n₁₂], [n₂₁, n₂₂]] of |kGLVCoeffs| whose
+// determinant is r, the Babai rounding computes
+//
+//   β₁ = round(k * n₂₂ / r), β₂ = round(k * -n₁₂ / r)
+//   k₁ = k - β₁ * n₁₁ - β₂ * n₂₁, k₂ = -β₁ * n₁₂ - β₂ * n₂₂
+//
+// The divisions are replaced with multiplications by the rounding constants
+// gᵢ = round(2^m * nᵢ / r) and a shift by m = 64 * (N + 1) bits, which the
+// curve generator emits. Since |k₁| and |k₂| are far below 2^(64 * N - 1), the
+// rest is done modulo 2^(64 * N) and the signs are read from the top bit.
+// See https://github.com/bitcoin-core/secp256k1/blob/master/src/scalar_impl.h
+template <typename Curve>
+class GLVDecomposition {
+ public:
+  using Config = typename Curve::Config;
+  using ScalarField = typename Curve::ScalarField;
+
+  constexpr static size_t N = ScalarField::N;
+
+  struct Result {
+    BigInt<N> k1;
+    BigInt<N> k2;
+    bool k1_is_negative = false;
+    bool k2_is_negative = false;
+  };
+
+  constexpr static Result Decompose(const ScalarField& k) {
+    return Decompose(k.ToBigInt());
+  }
+
+  constexpr static Result Decompose(const BigInt<N>& k) {
+    // β₁ and β₂
+    BigInt<N> beta1 = MulShiftRound(k, Config::kGLVRoundingConstantsAbs[0]);
+    BigInt<N> beta2 = MulShiftRound(k, Config::kGLVRoundingConstantsAbs[1]);
+    bool beta1_is_negative = Config::kGLVRoundingConstantsIsNegative[0];
+    bool beta2_is_negative = Config::kGLVRoundingConstantsIsNegative[1];
+
+    // k₁ = k - β₁ * n₁₁ - β₂ * n₂₁
+    BigInt<N> k1 = k;
+    SubSignedProduct(beta1, beta1_is_negative, 0, k1);
+    SubSignedProduct(beta2, beta2_is_negative, 2, k1);
+    // k₂ = -β₁ * n₁₂ - β₂ * n₂₂
+    BigInt<N> k2;
+    SubSignedProduct(beta1, beta1_is_negative, 1, k2);
+    SubSignedProduct(beta2, beta2_is_negative, 3, k2);
+
+    Result result;
+    result.k1_is_negative = ToSignMagnitude(k1);
+    result.k2_is_negative = ToSignMagnitude(k2);
+    result.k1 = k1;
+    result.k2 = k2;
+    return result;
+  }
+
+ private:
+  // Returns round(|a| * |b| / 2^(64 * (N + 1))).
+  constexpr static BigInt<N> MulShiftRound(const BigInt<N>& a,
+                                           const BigInt<N>& b) {
+    BigInt<N> lo = a;
+    BigInt<N> hi;
+    lo.MulInPlace(b, hi);
+    BigInt<N> ret;
+    for (size_t i = 1; i < N; ++i) {
+      ret[i - 1] = hi[i];
+    }
+    // Adds the bit right below the shift for rounding.
+    BigInt<N> round(hi[0] >> 63);
+    return ret += round;
+  }
+
+  // |acc| -= β * n where n is the |coeff_idx|-th |kGLVCoeffs| modulo
+  // 2^(64 * N).
+  constexpr static void SubSignedProduct(const BigInt<N>& beta,
+                                         bool beta_is_negative,
+                                         size_t coeff_idx, BigInt<N>& acc) {
+    BigInt<N> product = beta * Config::kGLVCoeffsAbs[coeff_idx];
+    if (beta_is_negative != Config::kGLVCoeffsIsNegative[coeff_idx]) {
+      acc += product;
+    } else {
+      acc -= product;
+    }
+  }
+
+  // Converts |value| in two's complement into its absolute value and returns
+  // true if it was negative.
+  constexpr static bool ToSignMagnitude(BigInt<N>& value) {
+    if ((value.biggest_limb() >> 63) == 0) return false;
+    value = BigInt<N>::Zero() - value;
+    return true;
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_DECOMPOSITION_H_
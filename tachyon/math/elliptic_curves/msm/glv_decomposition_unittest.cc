@@ -0,0 +1,58 @@
+#include "tachyon/math/elliptic_curves/msm/glv_decomposition.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g2.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
+
+namespace tachyon::math {
+
+namespace {
+
+template <typename Curve>
+class GLVDecompositionTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { Curve::Init(); }
+};
+
+}  // namespace
+
+using CurveTypes =
+    testing::Types<bls12_381::G1Curve, bls12_381::G2Curve, bn254::G1Curve,
+                   bn254::G2Curve, secp256k1::Curve>;
+TYPED_TEST_SUITE(GLVDecompositionTest, CurveTypes);
+
+TYPED_TEST(GLVDecompositionTest, Decompose) {
+  using Curve = TypeParam;
+  using ScalarField = typename Curve::ScalarField;
+  using BigIntTy = BigInt<ScalarField::N>;
+
+  // Both halves should be about half as long as the scalar field.
+  BigIntTy bound = BigIntTy::One();
+  bound.MulBy2ExpInPlace((ScalarField::Config::kModulusBits + 1) / 2 + 2);
+
+  std::vector<ScalarField> scalars = {ScalarField::Zero(), ScalarField::One(),
+                                      -ScalarField::One(),
+                                      Curve::Config::kLambda};
+  for (size_t i = 0; i < 100; ++i) {
+    scalars.push_back(ScalarField::Random());
+  }
+  for (const ScalarField& scalar : scalars) {
+    auto result = GLVDecomposition<Curve>::Decompose(scalar);
+    EXPECT_LT(result.k1, bound);
+    EXPECT_LT(result.k2, bound);
+
+    ScalarField k1 = ScalarField::FromBigInt(result.k1);
+    ScalarField k2 = ScalarField::FromBigInt(result.k2);
+    if (result.k1_is_negative) k1.NegInPlace();
+    if (result.k2_is_negative) k2.NegInPlace();
+    EXPECT_EQ(scalar, k1 + Curve::Config::kLambda * k2);
+  }
+}
+
+}  // namespace tachyon::math
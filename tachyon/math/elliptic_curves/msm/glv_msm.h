@@ -0,0 +1,173 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/window_digits.h"
+#include "tachyon/math/elliptic_curves/msm/glv_decomposition.h"
+#include "tachyon/math/elliptic_curves/msm/msm_util.h"
+
+namespace tachyon::math {
+
+// MSM(Multi-Scalar Multiplication) on curves with an efficient endomorphism
+// φ(P) = λ * P:
+// s₀ * g₀ + s₁ * g₁ + ... + sₙ * gₙ
+//
+// Every scalar sᵢ is decomposed into kᵢ₁ + λ * kᵢ₂ where kᵢ₁ and kᵢ₂ are about
+// half as long as sᵢ. Then Pippenger runs over 2n bases,
+// [g₀, ..., gₙ₋₁, φ(g₀), ..., φ(gₙ₋₁)], with the half length scalars, which
+// halves the number of windows and hence the number of bucket reductions and
+// doublings. The scalars are decomposed by |GLVDecomposition| without GMP.
+// φ(gᵢ) costs a single base field multiplication, and it can be cached by
+// |CacheBases()| when the same bases are used many times.
+template <typename PointTy>
+class GLVMSM {
+ public:
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+
+  GLVMSM() = default;
+
+  // Returns [g₀, ..., gₙ₋₁, φ(g₀), ..., φ(gₙ₋₁)] cached by |CacheBases()|.
+  const std::vector<PointTy>& glv_bases() const { return glv_bases_; }
+
+  // See |Pippenger::SetUseBatchAffine()|.
+  void SetUseBatchAffine(bool use_batch_affine) {
+    use_batch_affine_ = use_batch_affine;
+    if (Pippenger<PointTy>::kCanUseBatchAffine && use_batch_affine) {
+      use_bucket_sort_ = false;
+    }
+  }
+
+  // See |Pippenger::SetUseBucketSort()|.
+  void SetUseBucketSort(bool use_bucket_sort) {
+    use_bucket_sort_ = use_bucket_sort;
+    if (use_bucket_sort) use_batch_affine_ = false;
+  }
+
+  // Caches |bases| together with their endomorphisms so that |Run()| without
+  // bases doesn't compute them again.
+  template <typename BaseContainer>
+  void CacheBases(const BaseContainer& bases) {
+    glv_bases_ = CreateGLVBases(bases);
+  }
+
+  // Computes the MSM over the first |std::size(scalars)| cached bases.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars, Bucket* ret) const {
+    size_t scalars_size = std::size(scalars);
+    size_t bases_size = glv_bases_.size() / 2;
+    if (scalars_size > bases_size) {
+      LOG(ERROR) << "Too many scalars: " << scalars_size << " > "
+                 << bases_size;
+      return false;
+    }
+    if (scalars_size == bases_size) {
+      return RunWithGLVBases(glv_bases_, scalars, ret);
+    }
+    std::vector<PointTy> glv_bases;
+    glv_bases.reserve(2 * scalars_size);
+    glv_bases.insert(glv_bases.end(), glv_bases_.begin(),
+                     glv_bases_.begin() + scalars_size);
+    glv_bases.insert(glv_bases.end(), glv_bases_.begin() + bases_size,
+                     glv_bases_.begin() + bases_size + scalars_size);
+    return RunWithGLVBases(glv_bases, scalars, ret);
+  }
+
+  template <typename BaseContainer, typename ScalarContainer>
+  [[nodiscard]] bool Run(const BaseContainer& bases,
+                         const ScalarContainer& scalars, Bucket* ret) const {
+    if (std::size(bases) != std::size(scalars)) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+    return RunWithGLVBases(CreateGLVBases(bases), scalars, ret);
+  }
+
+ private:
+  template <typename BaseContainer>
+  static std::vector<PointTy> CreateGLVBases(const BaseContainer& bases) {
+    size_t size = std::size(bases);
+    std::vector<PointTy> glv_bases(2 * size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      const PointTy& base = *(std::begin(bases) + i);
+      glv_bases[i] = base;
+      glv_bases[size + i] = PointTy::Endomorphism(base);
+    }
+    return glv_bases;
+  }
+
+  template <typename ScalarContainer>
+  bool RunWithGLVBases(absl::Span<const PointTy> glv_bases,
+                       const ScalarContainer& scalars, Bucket* ret) const {
+    size_t size = std::size(scalars);
+    if (size == 0) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+
+    // |halves[i]| and |halves[size + i]| are |kᵢ₁| and |kᵢ₂|.
+    std::vector<BigInt<N>> halves(2 * size);
+    std::vector<uint8_t> negatives(2 * size);
+    std::vector<size_t> bits(size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < size; ++i) {
+      auto result = GLVDecomposition<typename PointTy::Curve>::Decompose(
+          *(std::begin(scalars) + i));
+      halves[i] = result.k1;
+      halves[size + i] = result.k2;
+      negatives[i] = result.k1_is_negative;
+      negatives[size + i] = result.k2_is_negative;
+      bits[i] = std::max(GetScalarBits(result.k1), GetScalarBits(result.k2));
+    }
+    size_t max_bits = std::max(*std::max_element(bits.begin(), bits.end()),
+                               size_t{1});
+
+    unsigned int window_bits = PippengerCtx::ComputeWindowsBits(2 * size);
+    size_t window_count = (max_bits + window_bits - 1) / window_bits;
+    if (WindowDigits<int16_t>::CanHoldDigits(window_bits)) {
+      return RunWithDigits<int16_t>(glv_bases, halves, negatives, window_bits,
+                                    window_count, ret);
+    } else {
+      return RunWithDigits<int32_t>(glv_bases, halves, negatives, window_bits,
+                                    window_count, ret);
+    }
+  }
+
+  template <typename Digit>
+  bool RunWithDigits(absl::Span<const PointTy> glv_bases,
+                     const std::vector<BigInt<N>>& halves,
+                     const std::vector<uint8_t>& negatives, size_t window_bits,
+                     size_t window_count, Bucket* ret) const {
+    WindowDigits<Digit> digits(halves.size(), window_bits, window_count);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < halves.size(); ++i) {
+      digits.Fill(i, halves[i], negatives[i]);
+    }
+    Pippenger<PointTy> pippenger;
+    pippenger.SetUseBatchAffine(use_batch_affine_);
+    pippenger.SetUseBucketSort(use_bucket_sort_);
+    return pippenger.RunWithWindowDigits(glv_bases.begin(), glv_bases.end(),
+                                         digits, ret);
+  }
+
+  bool use_batch_affine_ = Pippenger<PointTy>::kUseBatchAffineByDefault;
+  bool use_bucket_sort_ = false;
+  std::vector<PointTy> glv_bases_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_GLV_MSM_H_
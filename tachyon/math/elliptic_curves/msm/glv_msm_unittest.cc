@@ -0,0 +1,99 @@
+#include "tachyon/math/elliptic_curves/msm/glv_msm.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename PointTy>
+class GLVMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+
+  GLVMSMTest()
+      : test_set_(MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNaive)) {}
+  GLVMSMTest(const GLVMSMTest&) = delete;
+  GLVMSMTest& operator=(const GLVMSMTest&) = delete;
+  ~GLVMSMTest() override = default;
+
+ protected:
+  MSMTestSet<PointTy> test_set_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bls12_381::G1AffinePoint, secp256k1::AffinePoint>;
+TYPED_TEST_SUITE(GLVMSMTest, PointTypes);
+
+TYPED_TEST(GLVMSMTest, Run) {
+  using PointTy = TypeParam;
+  using Bucket = typename GLVMSM<PointTy>::Bucket;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  for (bool use_batch_affine : {false, true}) {
+    for (bool use_bucket_sort : {false, true}) {
+      GLVMSM<PointTy> msm;
+      msm.SetUseBatchAffine(use_batch_affine);
+      msm.SetUseBucketSort(use_bucket_sort);
+      Bucket ret;
+      ASSERT_TRUE(msm.Run(test_set.bases, test_set.scalars, &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
+TYPED_TEST(GLVMSMTest, RunWithCachedBases) {
+  using PointTy = TypeParam;
+  using Bucket = typename GLVMSM<PointTy>::Bucket;
+  using ScalarField = typename PointTy::ScalarField;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  GLVMSM<PointTy> msm;
+  msm.CacheBases(test_set.bases);
+  EXPECT_EQ(msm.glv_bases().size(), 2 * kSize);
+
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(test_set.scalars, &ret));
+  EXPECT_EQ(ret, test_set.answer);
+
+  std::vector<ScalarField> scalars(test_set.scalars.begin(),
+                                   test_set.scalars.begin() + kSize / 2);
+  std::vector<PointTy> bases(test_set.bases.begin(),
+                             test_set.bases.begin() + kSize / 2);
+  Bucket expected;
+  ASSERT_TRUE(msm.Run(bases, scalars, &expected));
+  ASSERT_TRUE(msm.Run(scalars, &ret));
+  EXPECT_EQ(ret, expected);
+
+  scalars.resize(kSize + 1);
+  EXPECT_FALSE(msm.Run(scalars, &ret));
+}
+
+TYPED_TEST(GLVMSMTest, RunWithLargeWindows) {
+  using PointTy = TypeParam;
+  using Bucket = typename GLVMSM<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(1 << 10, MSMMethod::kMSM);
+
+  GLVMSM<PointTy> msm;
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(test_set.bases, test_set.scalars, &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+}  // namespace tachyon::math
@@ -7,6 +7,7 @@
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
 #include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/curve.h"
 
 namespace tachyon::math {
 
@@ -26,7 +27,7 @@ using PointTypes =
     testing::Types<bls12_381::G1AffinePoint, bls12_381::G1ProjectivePoint,
                    bls12_381::G1JacobianPoint, bls12_381::G1PointXYZZ,
                    bls12_381::G2JacobianPoint, bn254::G1JacobianPoint,
-                   bn254::G2JacobianPoint>;
+                   bn254::G2JacobianPoint, secp256k1::JacobianPoint>;
 TYPED_TEST_SUITE(GLVTest, PointTypes);
 
 TYPED_TEST(GLVTest, Endomorphism) {
@@ -0,0 +1,101 @@
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "absl/strings/str_join.h"
+#include "absl/strings/substitute.h"
+
+#include "tachyon/base/bits.h"
+#include "tachyon/base/logging.h"
+
+namespace tachyon::math {
+
+std::string_view MSMPhaseToString(MSMPhase phase) {
+  switch (phase) {
+    case MSMPhase::kScalarConversion:
+      return "scalar_conversion";
+    case MSMPhase::kDigitDecomposition:
+      return "digit_decomposition";
+    case MSMPhase::kBucketAccumulation:
+      return "bucket_accumulation";
+    case MSMPhase::kBucketReduction:
+      return "bucket_reduction";
+    case MSMPhase::kWindowCombine:
+      return "window_combine";
+  }
+  NOTREACHED();
+  return "";
+}
+
+// static
+size_t MSMStats::GetOccupancyClass(uint64_t bucket_size) {
+  if (bucket_size == 0) return 0;
+  return std::min(static_cast<size_t>(base::bits::Log2Floor(bucket_size)) + 1,
+                  kOccupancyClassNums - 1);
+}
+
+base::TimeDelta MSMStats::GetTotalTime() const {
+  int64_t total = 0;
+  for (int64_t time : times_in_us) {
+    total += time;
+  }
+  return base::Microseconds(total);
+}
+
+uint64_t MSMStats::GetBucketNums() const {
+  uint64_t total = 0;
+  for (uint64_t nums : bucket_occupancy) {
+    total += nums;
+  }
+  return total;
+}
+
+void MSMStats::AddTime(MSMPhase phase, base::TimeDelta time) {
+  int64_t& total = times_in_us[static_cast<size_t>(phase)];
+  int64_t time_in_us = time.InMicroseconds();
+#if defined(TACHYON_HAS_OPENMP)
+#pragma omp atomic
+#endif  // defined(TACHYON_HAS_OPENMP)
+  total += time_in_us;
+}
+
+void MSMStats::AddBucketSizes(absl::Span<const uint32_t> bucket_sizes) {
+  std::array<uint64_t, kOccupancyClassNums> occupancy{};
+  for (uint32_t bucket_size : bucket_sizes) {
+    ++occupancy[GetOccupancyClass(bucket_size)];
+  }
+  for (size_t i = 0; i < kOccupancyClassNums; ++i) {
+    if (occupancy[i] == 0) continue;
+#if defined(TACHYON_HAS_OPENMP)
+#pragma omp atomic
+#endif  // defined(TACHYON_HAS_OPENMP)
+    bucket_occupancy[i] += occupancy[i];
+  }
+}
+
+std::string MSMStats::ToString() const {
+  std::vector<std::string> phases;
+  for (size_t i = 0; i < kMSMPhaseNums; ++i) {
+    phases.push_back(absl::Substitute(
+        "$0: $1us", MSMPhaseToString(static_cast<MSMPhase>(i)),
+        times_in_us[i]));
+  }
+  std::vector<std::string> occupancy;
+  for (size_t i = 0; i < kOccupancyClassNums; ++i) {
+    if (bucket_occupancy[i] == 0) continue;
+    if (i == 0) {
+      occupancy.push_back(absl::Substitute("0: $0", bucket_occupancy[i]));
+    } else {
+      occupancy.push_back(absl::Substitute("[$0, $1): $2",
+                                           uint64_t{1} << (i - 1),
+                                           uint64_t{1} << i,
+                                           bucket_occupancy[i]));
+    }
+  }
+  return absl::Substitute("{times: {$0}, bucket_occupancy: {$1}}",
+                          absl::StrJoin(phases, ", "),
+                          absl::StrJoin(occupancy, ", "));
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,137 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_STATS_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_STATS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/time/time.h"
+#include "tachyon/export.h"
+
+namespace tachyon::math {
+
+enum class MSMPhase {
+  kScalarConversion,
+  kDigitDecomposition,
+  kBucketAccumulation,
+  kBucketReduction,
+  kWindowCombine,
+};
+
+constexpr size_t kMSMPhaseNums = 5;
+
+TACHYON_EXPORT std::string_view MSMPhaseToString(MSMPhase phase);
+
+// MSMStats collects where the time of MSMs goes, phase by phase, and how many
+// bases go into a bucket. An MSM fills the stats given to its |SetStats()|,
+// adding to what they already have, only when it's built with
+// --//:has_msm_stats, which defines TACHYON_HAS_MSM_STATS. Otherwise, nothing
+// is recorded and |MSMPhaseTimer| and |MSMBucketCounter| compile to nothing.
+struct TACHYON_EXPORT MSMStats {
+#if defined(TACHYON_HAS_MSM_STATS)
+  constexpr static bool kEnabled = true;
+#else
+  constexpr static bool kEnabled = false;
+#endif  // defined(TACHYON_HAS_MSM_STATS)
+
+  // Buckets are counted by the classes of their sizes. See
+  // |GetOccupancyClass()|.
+  constexpr static size_t kOccupancyClassNums = 33;
+
+  // The time spent in each phase in microseconds. The phases which run per
+  // window add up the time of every window, so that they can exceed the wall
+  // time when windows run in parallel.
+  std::array<int64_t, kMSMPhaseNums> times_in_us{};
+  // |bucket_occupancy[k]| is the number of buckets in |GetOccupancyClass()|
+  // k over every window.
+  std::array<uint64_t, kOccupancyClassNums> bucket_occupancy{};
+
+  // Returns 0 for an empty bucket and k for a bucket of [2ᵏ⁻¹, 2ᵏ) bases.
+  static size_t GetOccupancyClass(uint64_t bucket_size);
+
+  base::TimeDelta GetTime(MSMPhase phase) const {
+    return base::Microseconds(times_in_us[static_cast<size_t>(phase)]);
+  }
+  base::TimeDelta GetTotalTime() const;
+  uint64_t GetBucketNums() const;
+
+  // These are safe to call from multiple threads at once.
+  void AddTime(MSMPhase phase, base::TimeDelta time);
+  void AddBucketSizes(absl::Span<const uint32_t> bucket_sizes);
+
+  void Reset() { *this = MSMStats(); }
+
+  std::string ToString() const;
+};
+
+// Adds the time from its construction to |Stop()| or its destruction to the
+// |phase| of |stats| if it's not null.
+class MSMPhaseTimer {
+ public:
+#if defined(TACHYON_HAS_MSM_STATS)
+  MSMPhaseTimer(MSMStats* stats, MSMPhase phase)
+      : stats_(stats), phase_(phase) {
+    if (stats_) start_ = base::TimeTicks::Now();
+  }
+  MSMPhaseTimer(const MSMPhaseTimer& other) = delete;
+  MSMPhaseTimer& operator=(const MSMPhaseTimer& other) = delete;
+  ~MSMPhaseTimer() { Stop(); }
+
+  void Stop() {
+    if (!stats_) return;
+    stats_->AddTime(phase_, base::TimeTicks::Now() - start_);
+    stats_ = nullptr;
+  }
+
+ private:
+  MSMStats* stats_;
+  MSMPhase phase_;
+  base::TimeTicks start_;
+#else
+  MSMPhaseTimer(MSMStats* stats, MSMPhase phase) {}
+  MSMPhaseTimer(const MSMPhaseTimer& other) = delete;
+  MSMPhaseTimer& operator=(const MSMPhaseTimer& other) = delete;
+
+  void Stop() {}
+#endif  // defined(TACHYON_HAS_MSM_STATS)
+};
+
+// Counts the bases which go into each of |bucket_nums| buckets and adds the
+// sizes to |stats| on destruction if it's not null.
+class MSMBucketCounter {
+ public:
+#if defined(TACHYON_HAS_MSM_STATS)
+  MSMBucketCounter(MSMStats* stats, size_t bucket_nums) : stats_(stats) {
+    if (stats_) bucket_sizes_.resize(bucket_nums);
+  }
+  MSMBucketCounter(const MSMBucketCounter& other) = delete;
+  MSMBucketCounter& operator=(const MSMBucketCounter& other) = delete;
+  ~MSMBucketCounter() {
+    if (stats_) stats_->AddBucketSizes(bucket_sizes_);
+  }
+
+  void Count(size_t bucket_index) {
+    if (stats_) ++bucket_sizes_[bucket_index];
+  }
+
+ private:
+  MSMStats* stats_;
+  std::vector<uint32_t> bucket_sizes_;
+#else
+  MSMBucketCounter(MSMStats* stats, size_t bucket_nums) {}
+  MSMBucketCounter(const MSMBucketCounter& other) = delete;
+  MSMBucketCounter& operator=(const MSMBucketCounter& other) = delete;
+
+  void Count(size_t bucket_index) {}
+#endif  // defined(TACHYON_HAS_MSM_STATS)
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_STATS_H_
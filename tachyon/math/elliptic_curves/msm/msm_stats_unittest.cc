@@ -0,0 +1,62 @@
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace tachyon::math {
+
+TEST(MSMStatsTest, GetOccupancyClass) {
+  EXPECT_EQ(MSMStats::GetOccupancyClass(0), 0);
+  EXPECT_EQ(MSMStats::GetOccupancyClass(1), 1);
+  EXPECT_EQ(MSMStats::GetOccupancyClass(2), 2);
+  EXPECT_EQ(MSMStats::GetOccupancyClass(3), 2);
+  EXPECT_EQ(MSMStats::GetOccupancyClass(4), 3);
+  EXPECT_EQ(MSMStats::GetOccupancyClass(uint64_t{1} << 40),
+            MSMStats::kOccupancyClassNums - 1);
+}
+
+TEST(MSMStatsTest, AddTime) {
+  MSMStats stats;
+  stats.AddTime(MSMPhase::kBucketAccumulation, base::Microseconds(3));
+  stats.AddTime(MSMPhase::kBucketAccumulation, base::Microseconds(4));
+  stats.AddTime(MSMPhase::kWindowCombine, base::Microseconds(5));
+  EXPECT_EQ(stats.GetTime(MSMPhase::kBucketAccumulation),
+            base::Microseconds(7));
+  EXPECT_EQ(stats.GetTime(MSMPhase::kWindowCombine), base::Microseconds(5));
+  EXPECT_EQ(stats.GetTime(MSMPhase::kScalarConversion), base::TimeDelta());
+  EXPECT_EQ(stats.GetTotalTime(), base::Microseconds(12));
+}
+
+TEST(MSMStatsTest, AddBucketSizes) {
+  MSMStats stats;
+  std::vector<uint32_t> bucket_sizes = {0, 1, 2, 3, 0, 8};
+  stats.AddBucketSizes(bucket_sizes);
+  EXPECT_EQ(stats.bucket_occupancy[0], 2);
+  EXPECT_EQ(stats.bucket_occupancy[1], 1);
+  EXPECT_EQ(stats.bucket_occupancy[2], 2);
+  EXPECT_EQ(stats.bucket_occupancy[3], 0);
+  EXPECT_EQ(stats.bucket_occupancy[4], 1);
+  EXPECT_EQ(stats.GetBucketNums(), bucket_sizes.size());
+}
+
+TEST(MSMStatsTest, Reset) {
+  MSMStats stats;
+  stats.AddTime(MSMPhase::kBucketReduction, base::Microseconds(1));
+  stats.AddBucketSizes(std::vector<uint32_t>{1, 2});
+  stats.Reset();
+  EXPECT_EQ(stats.GetTotalTime(), base::TimeDelta());
+  EXPECT_EQ(stats.GetBucketNums(), 0);
+}
+
+TEST(MSMStatsTest, ToString) {
+  MSMStats stats;
+  stats.AddTime(MSMPhase::kBucketAccumulation, base::Microseconds(10));
+  stats.AddBucketSizes(std::vector<uint32_t>{0, 3});
+  EXPECT_EQ(stats.ToString(),
+            "{times: {scalar_conversion: 0us, digit_decomposition: 0us, "
+            "bucket_accumulation: 10us, bucket_reduction: 0us, "
+            "window_combine: 0us}, bucket_occupancy: {0: 1, [2, 4): 1}}");
+}
+
+}  // namespace tachyon::math
@@ -1,10 +1,14 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_UTIL_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_UTIL_H_
 
+#include <stddef.h>
+
 #include <cmath>
 #include <type_traits>
 
+#include "tachyon/base/bits.h"
 #include "tachyon/base/template_util.h"
+#include "tachyon/math/base/big_int.h"
 
 namespace tachyon::math {
 
@@ -14,6 +18,17 @@ inline constexpr bool IsAbleToMSM =
     std::is_same_v<PointTy, base::iter_value_t<BaseInputIterator>> &&
     std::is_same_v<ScalarField, base::iter_value_t<ScalarInputIterator>>;
 
+// Returns the number of bits of |scalar| without the leading zeros.
+template <size_t N>
+constexpr size_t GetScalarBits(const BigInt<N>& scalar) {
+  for (size_t i = N - 1; i != SIZE_MAX; --i) {
+    if (scalar[i] != 0) {
+      return i * 64 + base::bits::Log2Floor(scalar[i]) + 1;
+    }
+  }
+  return 0;
+}
+
 }  // namespace tachyon::math
 
 #endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_MSM_UTIL_H_
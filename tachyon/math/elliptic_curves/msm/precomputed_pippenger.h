@@ -0,0 +1,342 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_PIPPENGER_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_PIPPENGER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/buffer/copyable.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/window_digits.h"
+#include "tachyon/math/elliptic_curves/point_conversions.h"
+
+namespace tachyon {
+namespace math {
+
+// Pippenger over bases which are known in advance, e.g., an SRS:
+// s₀ * g₀ + s₁ * g₁ + ... + sₙ * gₙ
+//
+// Every scalar is split into w signed digits of c bits as in |Pippenger|. With
+// a precompute factor q, the table keeps 2^(m * q * c) * gᵢ in affine form for
+// every m in [0, ⌈w / q⌉). The k-th digit of sᵢ is then added with the
+// (k / q)-th multiple of gᵢ into the (k % q)-th of q bucket sets, so that all
+// the windows share q bucket sets and only q - 1 windows are combined by
+// doublings at the end. With q = 1, every digit goes into a single bucket set
+// and no doublings are left. The table is n * ⌈w / q⌉ affine points, the first
+// of which are the bases themselves, so that it is serialized in place of the
+// bases. See |base::Copyable<PrecomputedPippenger<PointTy>>|.
+//
+// NOTE: |VariableBaseMSM| and the registered bases of the C API, i.e.,
+// |c::math::MSMBases|, don't build or use the table yet, so callers with fixed
+// bases run this directly for now.
+template <typename PointTy>
+class PrecomputedPippenger : public PippengerBase<PointTy> {
+ public:
+  using Curve = typename PointTy::Curve;
+  using ScalarField = typename PointTy::ScalarField;
+  using AffinePointTy = AffinePoint<Curve>;
+  using JacobianPointTy = JacobianPoint<Curve>;
+  using Bucket = typename PippengerBase<PointTy>::Bucket;
+
+  // Digits of the last window can be as large as 2^|window_bits|, which
+  // |int32_t| holds. See |WindowDigits::CanHoldDigits()|.
+  constexpr static size_t kMaxWindowBits = 24;
+  constexpr static size_t kPrecomputeChunkEntries = size_t{1} << 16;
+  // The memory the bucket sets of every thread may take up in |Run()|. See
+  // |ComputeWindowBits()|.
+  constexpr static size_t kMaxBucketsBytes = size_t{1} << 28;
+
+  PrecomputedPippenger() = default;
+
+  size_t size() const { return size_; }
+  size_t window_bits() const { return window_bits_; }
+  size_t window_count() const { return window_count_; }
+  size_t precompute_factor() const { return precompute_factor_; }
+  const std::vector<AffinePointTy>& table() const { return table_; }
+
+  // Returns the number of multiples of a base in the table, ⌈w / q⌉.
+  constexpr static size_t ComputeMultipleCount(size_t window_bits,
+                                               size_t precompute_factor) {
+    size_t window_count =
+        PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    return (window_count + precompute_factor - 1) / precompute_factor;
+  }
+
+  // Returns the number of bytes of a table for |bases_size| bases.
+  constexpr static size_t ComputeTableBytes(size_t bases_size,
+                                            size_t window_bits,
+                                            size_t precompute_factor) {
+    return bases_size * ComputeMultipleCount(window_bits, precompute_factor) *
+           sizeof(AffinePointTy);
+  }
+
+  // Returns the window bits which minimizes the additions of an MSM of
+  // |bases_size| terms on |thread_nums| threads. They are n * w into the
+  // buckets, plus 2^(c - 1) * q * (T - 1) to add the q bucket sets of 2^(c - 1)
+  // buckets of the other threads into the ones of the first thread, plus about
+  // 2^c * q to reduce them. The window bits are also kept small enough for the
+  // bucket sets of every thread to fit in |kMaxBucketsBytes|.
+  constexpr static size_t ComputeWindowBits(size_t bases_size,
+                                            size_t precompute_factor,
+                                            size_t thread_nums) {
+    thread_nums = std::max(thread_nums, size_t{1});
+    size_t ret = 1;
+    size_t best_cost = SIZE_MAX;
+    for (size_t window_bits = 1; window_bits <= kMaxWindowBits;
+         ++window_bits) {
+      size_t window_count =
+          PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits);
+      size_t bucket_nums = (size_t{1} << (window_bits - 1)) *
+                           std::min(precompute_factor, window_count);
+      if (window_bits > 1 &&
+          bucket_nums * thread_nums * sizeof(Bucket) > kMaxBucketsBytes) {
+        break;
+      }
+      size_t cost =
+          bases_size * window_count + bucket_nums * (thread_nums + 1);
+      if (cost < best_cost) {
+        best_cost = cost;
+        ret = window_bits;
+      }
+    }
+    return ret;
+  }
+
+  // Builds the table for |bases| with the given |precompute_factor| and
+  // |window_bits|. If |window_bits| is 0, it's decided by
+  // |ComputeWindowBits()| for as many threads as OpenMP runs. A
+  // |precompute_factor| of the window count or more keeps only the bases and
+  // leaves every doubling as |Pippenger| does.
+  template <typename BaseContainer>
+  [[nodiscard]] bool Precompute(const BaseContainer& bases,
+                                size_t precompute_factor,
+                                size_t window_bits = 0) {
+    if (precompute_factor == 0) {
+      LOG(ERROR) << "Invalid precompute factor: " << precompute_factor;
+      return false;
+    }
+    size_ = std::size(bases);
+    if (window_bits == 0) {
+      window_bits = ComputeWindowBits(size_, precompute_factor,
+                                      base::GetNumOpenMPThreads());
+    }
+    if (window_bits > kMaxWindowBits) {
+      LOG(ERROR) << "Invalid window bits: " << window_bits;
+      return false;
+    }
+    window_bits_ = window_bits;
+    window_count_ = PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    precompute_factor_ = std::min(precompute_factor, window_count_);
+
+    size_t multiple_count = GetMultipleCount();
+    size_t doubling_count = precompute_factor_ * window_bits_;
+    table_.resize(size_ * multiple_count);
+    // The table is built in jacobian form chunk by chunk so that only a chunk
+    // of jacobian points lives at a time next to the affine table.
+    size_t chunk_size =
+        std::max(kPrecomputeChunkEntries / multiple_count, size_t{1});
+    std::vector<JacobianPointTy> jacobian_table;
+    for (size_t offset = 0; offset < size_; offset += chunk_size) {
+      size_t bases_size = std::min(chunk_size, size_ - offset);
+      jacobian_table.resize(bases_size * multiple_count);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < bases_size; ++i) {
+        JacobianPointTy* multiples = &jacobian_table[i * multiple_count];
+        multiples[0] =
+            ConvertPoint<JacobianPointTy>(*(std::begin(bases) + offset + i));
+        for (size_t m = 1; m < multiple_count; ++m) {
+          // 2^(m * q * c) * gᵢ
+          multiples[m] = multiples[m - 1];
+          for (size_t j = 0; j < doubling_count; ++j) {
+            multiples[m].DoubleInPlace();
+          }
+        }
+      }
+      absl::Span<AffinePointTy> affine_table = absl::MakeSpan(
+          &table_[offset * multiple_count], jacobian_table.size());
+      if (!JacobianPointTy::BatchToAffine(jacobian_table, &affine_table)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Computes the MSM over the first |std::size(scalars)| precomputed bases.
+  template <typename ScalarContainer>
+  [[nodiscard]] bool Run(const ScalarContainer& scalars, Bucket* ret) const {
+    size_t scalars_size = std::size(scalars);
+    if (scalars_size > size_) {
+      LOG(ERROR) << "Too many scalars: " << scalars_size << " > " << size_;
+      return false;
+    }
+    if (scalars_size == 0) {
+      *ret = Bucket::Zero();
+      return true;
+    }
+
+    // Each thread adds a chunk of the terms into its own bucket sets, which
+    // are then added up into the ones of the first chunk.
+    size_t thread_nums = base::GetNumOpenMPThreads();
+    size_t chunk_size = (scalars_size + thread_nums - 1) / thread_nums;
+    size_t chunk_nums = (scalars_size + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<Bucket>> chunk_buckets(chunk_nums);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < chunk_nums; ++i) {
+      size_t begin = i * chunk_size;
+      size_t end = std::min(begin + chunk_size, scalars_size);
+      chunk_buckets[i] = AccumulateChunk(std::begin(scalars) + begin, begin,
+                                         end - begin);
+    }
+    std::vector<Bucket>& buckets = chunk_buckets[0];
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < buckets.size(); ++i) {
+      for (size_t j = 1; j < chunk_nums; ++j) {
+        buckets[i] += chunk_buckets[j][i];
+      }
+    }
+
+    std::vector<size_t> bucket_set_offsets = GetBucketSetOffsets();
+    std::vector<Bucket> bucket_set_sums(precompute_factor_);
+    for (size_t j = 0; j < precompute_factor_; ++j) {
+      bucket_set_sums[j] = this->AccumulateBucketsInSegments(
+          absl::MakeConstSpan(buckets).subspan(bucket_set_offsets[j],
+                                               GetBucketSetSize(j)),
+          thread_nums);
+    }
+    // The j-th bucket set is weighted by 2^(j * c) as the j-th window.
+    *ret = this->AccumulateWindowSums(absl::MakeConstSpan(bucket_set_sums),
+                                      window_bits_);
+    return true;
+  }
+
+ private:
+  friend class base::Copyable<PrecomputedPippenger<PointTy>>;
+
+  size_t GetMultipleCount() const {
+    return (window_count_ + precompute_factor_ - 1) / precompute_factor_;
+  }
+
+  // The bucket set of the last window holds the digits up to 2^c, which need
+  // twice the buckets of the others.
+  size_t GetBucketSetSize(size_t bucket_set_index) const {
+    if (bucket_set_index == (window_count_ - 1) % precompute_factor_) {
+      return size_t{1} << window_bits_;
+    } else {
+      return size_t{1} << (window_bits_ - 1);
+    }
+  }
+
+  // Returns where each bucket set starts, followed by the total number of
+  // buckets.
+  std::vector<size_t> GetBucketSetOffsets() const {
+    std::vector<size_t> offsets(precompute_factor_ + 1);
+    for (size_t j = 0; j < precompute_factor_; ++j) {
+      offsets[j + 1] = offsets[j] + GetBucketSetSize(j);
+    }
+    return offsets;
+  }
+
+  template <typename ScalarInputIterator>
+  std::vector<Bucket> AccumulateChunk(ScalarInputIterator scalars_it,
+                                      size_t offset, size_t size) const {
+    size_t multiple_count = GetMultipleCount();
+    std::vector<size_t> bucket_set_offsets = GetBucketSetOffsets();
+    std::vector<Bucket> buckets(bucket_set_offsets.back(), Bucket::Zero());
+
+    std::vector<int32_t> digits(window_count_);
+    for (size_t i = offset; i < offset + size; ++i, ++scalars_it) {
+      FillDigits(scalars_it->ToBigInt(), window_bits_, digits.data(),
+                 window_count_);
+      const AffinePointTy* multiples = &table_[i * multiple_count];
+      for (size_t k = 0; k < window_count_; ++k) {
+        int32_t digit = digits[k];
+        if (digit == 0) continue;
+        const AffinePointTy& multiple = multiples[k / precompute_factor_];
+        Bucket* bucket_set =
+            &buckets[bucket_set_offsets[k % precompute_factor_]];
+        if (digit > 0) {
+          bucket_set[digit - 1] += multiple;
+        } else {
+          bucket_set[-digit - 1] -= multiple;
+        }
+      }
+    }
+    return buckets;
+  }
+
+  size_t size_ = 0;
+  size_t window_bits_ = 0;
+  size_t window_count_ = 0;
+  size_t precompute_factor_ = 1;
+  // |table_[i * ⌈w / q⌉ + m]| is 2^(m * q * c) * gᵢ.
+  std::vector<AffinePointTy> table_;
+};
+
+}  // namespace math
+
+namespace base {
+
+template <typename PointTy>
+class Copyable<math::PrecomputedPippenger<PointTy>> {
+ public:
+  using AffinePointTy =
+      typename math::PrecomputedPippenger<PointTy>::AffinePointTy;
+  using ScalarField = typename PointTy::ScalarField;
+
+  static bool WriteTo(const math::PrecomputedPippenger<PointTy>& msm,
+                      Buffer* buffer) {
+    return buffer->WriteMany(msm.window_bits_, msm.precompute_factor_,
+                             msm.table_);
+  }
+
+  static bool ReadFrom(const Buffer& buffer,
+                       math::PrecomputedPippenger<PointTy>* msm) {
+    size_t window_bits;
+    size_t precompute_factor;
+    std::vector<AffinePointTy> table;
+    if (!buffer.ReadMany(&window_bits, &precompute_factor, &table)) {
+      return false;
+    }
+    if (window_bits == 0 ||
+        window_bits > math::PrecomputedPippenger<PointTy>::kMaxWindowBits) {
+      LOG(ERROR) << "Invalid window bits: " << window_bits;
+      return false;
+    }
+    size_t window_count =
+        math::PippengerCtx::ComputeWindowsCount<ScalarField>(window_bits);
+    if (precompute_factor == 0 || precompute_factor > window_count) {
+      LOG(ERROR) << "Invalid precompute factor: " << precompute_factor;
+      return false;
+    }
+    size_t multiple_count = math::PrecomputedPippenger<
+        PointTy>::ComputeMultipleCount(window_bits, precompute_factor);
+    if (table.size() % multiple_count != 0) {
+      LOG(ERROR) << "Invalid table size: " << table.size();
+      return false;
+    }
+
+    msm->size_ = table.size() / multiple_count;
+    msm->window_bits_ = window_bits;
+    msm->window_count_ = window_count;
+    msm->precompute_factor_ = precompute_factor;
+    msm->table_ = std::move(table);
+    return true;
+  }
+
+  static size_t EstimateSize(const math::PrecomputedPippenger<PointTy>& msm) {
+    return base::EstimateSize(msm.window_bits_) +
+           base::EstimateSize(msm.precompute_factor_) +
+           base::EstimateSize(msm.table_);
+  }
+};
+
+}  // namespace base
+}  // namespace tachyon
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_PRECOMPUTED_PIPPENGER_H_
@@ -0,0 +1,48 @@
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/precomputed_pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+template <typename PointTy>
+void BM_Pippenger(benchmark::State& state) {
+  PointTy::Curve::Init();
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(state.range(0), MSMMethod::kNone);
+  Pippenger<PointTy> pippenger;
+  typename Pippenger<PointTy>::Bucket ret;
+  for (auto _ : state) {
+    pippenger.Run(test_set.bases.begin(), test_set.bases.end(),
+                  test_set.scalars.begin(), test_set.scalars.end(), &ret);
+  }
+  benchmark::DoNotOptimize(ret);
+}
+
+// |state.range(1)| is the precompute factor.
+template <typename PointTy>
+void BM_PrecomputedPippenger(benchmark::State& state) {
+  PointTy::Curve::Init();
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(state.range(0), MSMMethod::kNone);
+  PrecomputedPippenger<PointTy> msm;
+  CHECK(msm.Precompute(test_set.bases, state.range(1)));
+  typename PrecomputedPippenger<PointTy>::Bucket ret;
+  for (auto _ : state) {
+    CHECK(msm.Run(test_set.scalars, &ret));
+  }
+  benchmark::DoNotOptimize(ret);
+  state.counters["table_mib"] =
+      msm.table().size() * sizeof(AffinePoint<typename PointTy::Curve>) /
+      double{1 << 20};
+}
+
+BENCHMARK_TEMPLATE(BM_Pippenger, bn254::G1AffinePoint)
+    ->RangeMultiplier(4)
+    ->Range(1 << 12, 1 << 16);
+BENCHMARK_TEMPLATE(BM_PrecomputedPippenger, bn254::G1AffinePoint)
+    ->ArgsProduct({benchmark::CreateRange(1 << 12, 1 << 16, 4), {1, 2, 4}});
+
+}  // namespace tachyon::math
@@ -0,0 +1,145 @@
+#include "tachyon/math/elliptic_curves/msm/precomputed_pippenger.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/buffer/vector_buffer.h"
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 40;
+
+template <typename PointTy>
+class PrecomputedPippengerTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bls12_381::G1AffinePoint, bn254::G2AffinePoint>;
+TYPED_TEST_SUITE(PrecomputedPippengerTest, PointTypes);
+
+TYPED_TEST(PrecomputedPippengerTest, ComputeWindowBits) {
+  using PrecomputedPippengerTy = PrecomputedPippenger<TypeParam>;
+  using Bucket = typename PrecomputedPippengerTy::Bucket;
+
+  for (size_t log_size : {10, 20, 24, 28}) {
+    SCOPED_TRACE(log_size);
+    size_t prev_window_bits = PrecomputedPippengerTy::kMaxWindowBits;
+    for (size_t thread_nums : {1, 8, 64}) {
+      SCOPED_TRACE(thread_nums);
+      size_t window_bits = PrecomputedPippengerTy::ComputeWindowBits(
+          size_t{1} << log_size, 1, thread_nums);
+      // The bucket sets of every thread fit in the bound.
+      EXPECT_LE((size_t{1} << (window_bits - 1)) * thread_nums * sizeof(Bucket),
+                PrecomputedPippengerTy::kMaxBucketsBytes);
+      // More threads don't take larger windows.
+      EXPECT_LE(window_bits, prev_window_bits);
+      prev_window_bits = window_bits;
+    }
+  }
+}
+
+TYPED_TEST(PrecomputedPippengerTest, Run) {
+  using PointTy = TypeParam;
+  using Bucket = typename PrecomputedPippenger<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNaive);
+
+  // A precompute factor of 1000 is clamped to the window count, which leaves
+  // only the bases in the table.
+  for (size_t precompute_factor : {1, 2, 5, 1000}) {
+    SCOPED_TRACE(precompute_factor);
+    for (size_t window_bits : {0, 1, 4, 9}) {
+      SCOPED_TRACE(window_bits);
+      PrecomputedPippenger<PointTy> msm;
+      ASSERT_TRUE(
+          msm.Precompute(test_set.bases, precompute_factor, window_bits));
+      Bucket ret;
+      ASSERT_TRUE(msm.Run(test_set.scalars, &ret));
+      EXPECT_EQ(ret, test_set.answer);
+    }
+  }
+}
+
+TYPED_TEST(PrecomputedPippengerTest, RunWithFewerScalars) {
+  using PointTy = TypeParam;
+  using Bucket = typename PrecomputedPippenger<PointTy>::Bucket;
+  using ScalarField = typename PointTy::ScalarField;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+  PrecomputedPippenger<PointTy> msm;
+  ASSERT_TRUE(msm.Precompute(test_set.bases, 2));
+
+  std::vector<ScalarField> scalars(test_set.scalars.begin(),
+                                   test_set.scalars.begin() + kSize / 2);
+  std::vector<PointTy> bases(test_set.bases.begin(),
+                             test_set.bases.begin() + kSize / 2);
+  Bucket expected;
+  VariableBaseMSM<PointTy> variable_base_msm;
+  ASSERT_TRUE(variable_base_msm.Run(bases, scalars, &expected));
+
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(scalars, &ret));
+  EXPECT_EQ(ret, expected);
+
+  ASSERT_TRUE(msm.Run(std::vector<ScalarField>(), &ret));
+  EXPECT_EQ(ret, Bucket::Zero());
+
+  std::vector<ScalarField> too_many_scalars(kSize + 1);
+  EXPECT_FALSE(msm.Run(too_many_scalars, &ret));
+}
+
+TYPED_TEST(PrecomputedPippengerTest, InvalidParams) {
+  using PointTy = TypeParam;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+  PrecomputedPippenger<PointTy> msm;
+  EXPECT_FALSE(msm.Precompute(test_set.bases, 0));
+  EXPECT_FALSE(msm.Precompute(
+      test_set.bases, 1, PrecomputedPippenger<PointTy>::kMaxWindowBits + 1));
+}
+
+TEST(PrecomputedPippengerCopyableTest, Copyable) {
+  using PointTy = bn254::G1AffinePoint;
+  using Bucket = PrecomputedPippenger<PointTy>::Bucket;
+
+  PointTy::Curve::Init();
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNaive);
+  PrecomputedPippenger<PointTy> expected;
+  ASSERT_TRUE(expected.Precompute(test_set.bases, 3));
+
+  base::VectorBuffer write_buf;
+  ASSERT_TRUE(write_buf.Write(expected));
+  EXPECT_EQ(write_buf.buffer_len(), base::EstimateSize(expected));
+
+  write_buf.set_buffer_offset(0);
+  PrecomputedPippenger<PointTy> value;
+  ASSERT_TRUE(write_buf.Read(&value));
+  EXPECT_EQ(value.size(), expected.size());
+  EXPECT_EQ(value.window_bits(), expected.window_bits());
+  EXPECT_EQ(value.window_count(), expected.window_count());
+  EXPECT_EQ(value.precompute_factor(), expected.precompute_factor());
+  EXPECT_EQ(value.table(), expected.table());
+
+  Bucket ret;
+  ASSERT_TRUE(value.Run(test_set.scalars, &ret));
+  EXPECT_EQ(ret, test_set.answer);
+}
+
+}  // namespace tachyon::math
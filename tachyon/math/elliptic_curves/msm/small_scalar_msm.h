@@ -0,0 +1,207 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_SMALL_SCALAR_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_SMALL_SCALAR_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/window_digits.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
+#include "tachyon/math/elliptic_curves/msm/msm_util.h"
+
+namespace tachyon::math {
+
+// MSM(Multi-Scalar Multiplication) which classifies the scalars by their bit
+// widths first, since witnesses are full of zeros, ones and short scalars
+// such as selectors, booleans and range checked limbs:
+//
+//   - Zeros are skipped.
+//   - Ones are summed directly.
+//   - Scalars up to |kMaxSmallScalarBits| go to a Pippenger whose windows
+//     only cover the bits of the longest of them.
+//   - The others go to |PippengerAdapter|.
+//
+// The results of the classes are added up at the end. A few scalars spread
+// over the inputs are sampled first, and when none of them is short, the
+// inputs are handed to |PippengerAdapter| as they are without classifying
+// every scalar.
+template <typename PointTy>
+class SmallScalarMSM {
+ public:
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename Pippenger<PointTy>::Bucket;
+
+  constexpr static size_t N = ScalarField::N;
+  constexpr static size_t kMaxSmallScalarBits = 64;
+  // See |SampleHasShortScalars()|.
+  constexpr static size_t kSampleSize = 32;
+
+  struct Stats {
+    size_t zero_nums = 0;
+    size_t one_nums = 0;
+    size_t small_nums = 0;
+    size_t large_nums = 0;
+  };
+
+  // Returns how the scalars of the last |Run()| were classified. Every scalar
+  // is counted as large when the sample has no short scalar.
+  const Stats& stats() const { return stats_; }
+
+  // See |Pippenger::SetStats()|. Both of the Pippengers add to |msm_stats|.
+  void SetMSMStats(MSMStats* msm_stats) { msm_stats_ = msm_stats; }
+
+  template <typename BaseInputIterator, typename ScalarInputIterator>
+  bool Run(BaseInputIterator bases_first, BaseInputIterator bases_last,
+           ScalarInputIterator scalars_first, ScalarInputIterator scalars_last,
+           Bucket* ret) {
+    size_t bases_size = std::distance(bases_first, bases_last);
+    size_t scalars_size = std::distance(scalars_first, scalars_last);
+    if (bases_size != scalars_size) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+
+    stats_ = Stats();
+    PippengerAdapter<PointTy> pippenger;
+    pippenger.SetStats(msm_stats_);
+    if (!SampleHasShortScalars(scalars_first, scalars_size)) {
+      stats_.large_nums = scalars_size;
+      return pippenger.Run(std::move(bases_first), std::move(bases_last),
+                           std::move(scalars_first), std::move(scalars_last),
+                           ret);
+    }
+
+    std::vector<BigInt<N>> scalars(scalars_size);
+    std::vector<uint16_t> bits(scalars_size);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < scalars_size; ++i) {
+      scalars[i] = (scalars_first + i)->ToBigInt();
+      bits[i] = static_cast<uint16_t>(GetScalarBits(scalars[i]));
+    }
+
+    Bucket one_sum = Bucket::Zero();
+    std::vector<size_t> small_indices;
+    std::vector<size_t> large_indices;
+    size_t small_max_bits = 0;
+    for (size_t i = 0; i < scalars_size; ++i) {
+      if (bits[i] == 0) {
+        ++stats_.zero_nums;
+      } else if (bits[i] == 1) {
+        ++stats_.one_nums;
+        one_sum += *(bases_first + i);
+      } else if (bits[i] <= kMaxSmallScalarBits) {
+        small_indices.push_back(i);
+        small_max_bits = std::max(small_max_bits, size_t{bits[i]});
+      } else {
+        large_indices.push_back(i);
+      }
+    }
+    stats_.small_nums = small_indices.size();
+    stats_.large_nums = large_indices.size();
+
+    if (large_indices.size() == scalars_size) {
+      return pippenger.Run(std::move(bases_first), std::move(bases_last),
+                           std::move(scalars_first), std::move(scalars_last),
+                           ret);
+    }
+
+    Bucket large_sum = Bucket::Zero();
+    if (!large_indices.empty()) {
+      if (!RunMasked(bases_first, bases_last, scalars, large_indices,
+                     ScalarField::Config::kModulusBits, &large_sum)) {
+        return false;
+      }
+    }
+
+    Bucket small_sum = Bucket::Zero();
+    if (!small_indices.empty()) {
+      if (!RunMasked(bases_first, bases_last, scalars, small_indices,
+                     small_max_bits, &small_sum)) {
+        return false;
+      }
+    }
+
+    *ret = one_sum + small_sum + large_sum;
+    return true;
+  }
+
+ private:
+  // Returns true if any of |kSampleSize| scalars evenly spread over
+  // [|scalars_first|, |scalars_first| + |size|) is short enough to be taken
+  // apart. Witnesses which have short scalars at all usually have them all
+  // over, while random scalars then skip converting them twice.
+  template <typename ScalarInputIterator>
+  static bool SampleHasShortScalars(ScalarInputIterator scalars_first,
+                                    size_t size) {
+    size_t sample_size = std::min(size, kSampleSize);
+    for (size_t i = 0; i < sample_size; ++i) {
+      const ScalarField& scalar = *(scalars_first + i * size / sample_size);
+      if (GetScalarBits(scalar.ToBigInt()) <= kMaxSmallScalarBits) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Runs a Pippenger over every base, but only with the |scalars| at
+  // |indices|, which have at most |max_bits| bits. The digits of the other
+  // scalars are left zero, so that their bases are skipped rather than
+  // gathered into a copy. The window bits are picked for the size of
+  // |indices|, and the profile of |PippengerAdapter| doesn't apply.
+  template <typename BaseInputIterator>
+  bool RunMasked(BaseInputIterator bases_first, BaseInputIterator bases_last,
+                 const std::vector<BigInt<N>>& scalars,
+                 const std::vector<size_t>& indices, size_t max_bits,
+                 Bucket* ret) const {
+    unsigned int window_bits = PippengerCtx::ComputeWindowsBits(indices.size());
+    size_t window_count = (max_bits + window_bits - 1) / window_bits;
+    if (WindowDigits<int16_t>::CanHoldDigits(window_bits)) {
+      return RunMaskedWithDigits<int16_t>(std::move(bases_first),
+                                          std::move(bases_last), scalars,
+                                          indices, window_bits, window_count,
+                                          ret);
+    } else {
+      return RunMaskedWithDigits<int32_t>(std::move(bases_first),
+                                          std::move(bases_last), scalars,
+                                          indices, window_bits, window_count,
+                                          ret);
+    }
+  }
+
+  template <typename Digit, typename BaseInputIterator>
+  bool RunMaskedWithDigits(BaseInputIterator bases_first,
+                           BaseInputIterator bases_last,
+                           const std::vector<BigInt<N>>& scalars,
+                           const std::vector<size_t>& indices,
+                           size_t window_bits, size_t window_count,
+                           Bucket* ret) const {
+    WindowDigits<Digit> digits(scalars.size(), window_bits, window_count);
+    OPENMP_PARALLEL_FOR(size_t i = 0; i < indices.size(); ++i) {
+      digits.Fill(indices[i], scalars[indices[i]]);
+    }
+    // Short scalars have only a few windows, which are then split into chunks
+    // to keep the threads busy.
+    Pippenger<PointTy> pippenger;
+    pippenger.SetChunkCount(0);
+    pippenger.SetStats(msm_stats_);
+    return pippenger.RunWithWindowDigits(std::move(bases_first),
+                                         std::move(bases_last), digits, ret);
+  }
+
+  Stats stats_;
+  // not owned
+  MSMStats* msm_stats_ = nullptr;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_SMALL_SCALAR_MSM_H_
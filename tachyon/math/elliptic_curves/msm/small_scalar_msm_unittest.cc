@@ -0,0 +1,119 @@
+#include "tachyon/math/elliptic_curves/msm/small_scalar_msm.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 100;
+
+template <typename PointTy>
+class SmallScalarMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bls12_381::G1AffinePoint>;
+TYPED_TEST_SUITE(SmallScalarMSMTest, PointTypes);
+
+TYPED_TEST(SmallScalarMSMTest, Run) {
+  using PointTy = TypeParam;
+  using Bucket = typename SmallScalarMSM<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Sparse(kSize, MSMMethod::kNaive);
+
+  SmallScalarMSM<PointTy> msm;
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(test_set.bases.begin(), test_set.bases.end(),
+                      test_set.scalars.begin(), test_set.scalars.end(), &ret));
+  EXPECT_EQ(ret, test_set.answer);
+
+  const typename SmallScalarMSM<PointTy>::Stats& stats = msm.stats();
+  EXPECT_EQ(stats.zero_nums + stats.one_nums + stats.small_nums +
+                stats.large_nums,
+            kSize);
+}
+
+TYPED_TEST(SmallScalarMSMTest, RunWithSingleClass) {
+  using PointTy = TypeParam;
+  using Bucket = typename SmallScalarMSM<PointTy>::Bucket;
+  using ScalarField = typename PointTy::ScalarField;
+  using AddResultTy =
+      typename internal::AdditiveSemigroupTraits<PointTy>::ReturnTy;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+  std::vector<std::vector<ScalarField>> scalars_list = {
+      base::CreateVector(kSize, ScalarField::Zero()),
+      base::CreateVector(kSize, ScalarField::One()),
+      base::CreateVector(kSize, ScalarField(uint64_t{0xffffffffffffffff})),
+      test_set.scalars,
+  };
+  for (size_t i = 0; i < scalars_list.size(); ++i) {
+    SCOPED_TRACE(absl::Substitute("i: $0", i));
+    const std::vector<ScalarField>& scalars = scalars_list[i];
+    AddResultTy expected = AddResultTy::Zero();
+    for (size_t j = 0; j < kSize; ++j) {
+      expected += test_set.bases[j].ScalarMul(scalars[j].ToBigInt());
+    }
+
+    SmallScalarMSM<PointTy> msm;
+    Bucket ret;
+    ASSERT_TRUE(msm.Run(test_set.bases.begin(), test_set.bases.end(),
+                        scalars.begin(), scalars.end(), &ret));
+    EXPECT_EQ(ret, ConvertPoint<Bucket>(expected));
+  }
+}
+
+TYPED_TEST(SmallScalarMSMTest, RunWithShortScalarsOutOfSample) {
+  using PointTy = TypeParam;
+  using Bucket = typename SmallScalarMSM<PointTy>::Bucket;
+  using ScalarField = typename PointTy::ScalarField;
+  using AddResultTy =
+      typename internal::AdditiveSemigroupTraits<PointTy>::ReturnTy;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+  // The 1st scalar is between the 0th and the next sampled one.
+  static_assert(kSize / SmallScalarMSM<PointTy>::kSampleSize > 1);
+  test_set.scalars[1] = ScalarField(3);
+  AddResultTy expected = AddResultTy::Zero();
+  for (size_t i = 0; i < kSize; ++i) {
+    expected += test_set.bases[i].ScalarMul(test_set.scalars[i].ToBigInt());
+  }
+
+  SmallScalarMSM<PointTy> msm;
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(test_set.bases.begin(), test_set.bases.end(),
+                      test_set.scalars.begin(), test_set.scalars.end(), &ret));
+  EXPECT_EQ(ret, ConvertPoint<Bucket>(expected));
+  EXPECT_EQ(msm.stats().large_nums, kSize);
+}
+
+TYPED_TEST(SmallScalarMSMTest, RunWithMismatchedSizes) {
+  using PointTy = TypeParam;
+  using Bucket = typename SmallScalarMSM<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+
+  SmallScalarMSM<PointTy> msm;
+  Bucket ret;
+  EXPECT_FALSE(msm.Run(test_set.bases.begin(), test_set.bases.end(),
+                       test_set.scalars.begin(), test_set.scalars.end() - 1,
+                       &ret));
+}
+
+}  // namespace tachyon::math
@@ -0,0 +1,238 @@
+#ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_STREAMING_MSM_H_
+#define TACHYON_MATH_ELLIPTIC_CURVES_MSM_STREAMING_MSM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/file.h"
+#include "tachyon/base/files/file_path.h"
+#include "tachyon/base/logging.h"
+#include "tachyon/base/openmp_util.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_base.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/window_digits.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
+#include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
+
+namespace tachyon::math {
+
+// StreamingMSM computes an MSM whose bases are stored in a file, without
+// loading all of them into memory. The bases are read in chunks of
+// |chunk_size()| bases into two buffers in turn, so that the next chunk is
+// read on another thread while the current one is added into the buckets.
+// The buckets of every window are kept across the chunks and reduced only
+// once after the last chunk, so that the result is the same as the one of
+// |Pippenger| over the whole bases.
+//
+// The memory it takes is about 2 chunks of bases, the digits of a chunk and
+// the buckets, whose window bits are lowered until they don't take more than
+// the chunks. An MSM which fits in a single chunk is read at once and run by
+// |VariableBaseMSM|.
+template <typename PointTy>
+class StreamingMSM : public PippengerBase<PointTy> {
+ public:
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename PippengerBase<PointTy>::Bucket;
+
+  static_assert(std::is_trivially_copyable_v<PointTy>,
+                "Bases should be stored in a file as they are in memory");
+
+  constexpr static size_t kDefaultChunkSize = size_t{1} << 20;
+  // A chunk is read by a single |base::File::Read()|, which takes an int.
+  constexpr static size_t kMaxChunkSize =
+      std::numeric_limits<int>::max() / sizeof(PointTy);
+
+  StreamingMSM() = default;
+
+  size_t chunk_size() const { return chunk_size_; }
+  void SetChunkSize(size_t chunk_size) {
+    DCHECK_GT(chunk_size, size_t{0});
+    DCHECK_LE(chunk_size, kMaxChunkSize);
+    chunk_size_ = chunk_size;
+  }
+
+  // See |Pippenger::SetStats()|.
+  void SetStats(MSMStats* stats) { stats_ = stats; }
+
+  // Writes |bases| into |path| in the layout |Run()| reads.
+  static bool WriteBases(const base::FilePath& path,
+                         absl::Span<const PointTy> bases) {
+    base::File file(path, base::File::FLAG_CREATE_ALWAYS |
+                              base::File::FLAG_WRITE);
+    if (!file.IsValid()) {
+      LOG(ERROR) << "Failed to create " << path.value();
+      return false;
+    }
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(bases.data());
+    size_t bytes = bases.size() * sizeof(PointTy);
+    for (size_t offset = 0; offset < bytes;) {
+      size_t len = std::min(bytes - offset, kMaxChunkSize * sizeof(PointTy));
+      if (!file.WriteAndCheck(offset, absl::MakeConstSpan(data + offset, len)))
+        return false;
+      offset += len;
+    }
+    return true;
+  }
+
+  // Computes the MSM of |scalars| and as many bases stored in |file| from
+  // |offset|, which are written by |WriteBases()|.
+  bool Run(base::File* file, int64_t offset,
+           absl::Span<const ScalarField> scalars, Bucket* ret) {
+    size_t size = scalars.size();
+    int64_t length = file->GetLength();
+    if (length < 0 || offset < 0 ||
+        static_cast<uint64_t>(length - std::min(offset, length)) <
+            size * sizeof(PointTy)) {
+      LOG(ERROR) << "The file doesn't hold as many bases as scalars";
+      return false;
+    }
+
+    if (size <= chunk_size_) {
+      std::vector<PointTy> bases(size);
+      if (!ReadChunk(file, offset, absl::MakeSpan(bases))) return false;
+      VariableBaseMSM<PointTy> msm;
+      msm.SetStats(stats_);
+      return msm.Run(bases, scalars, ret);
+    }
+
+    ctx_ = CreateCtx(size);
+    if (WindowDigits<int16_t>::CanHoldDigits(ctx_.window_bits)) {
+      return DoRun<int16_t>(file, offset, scalars, ret);
+    } else {
+      return DoRun<int32_t>(file, offset, scalars, ret);
+    }
+  }
+
+ private:
+  PippengerCtx CreateCtx(size_t size) const {
+    PippengerCtx ctx = PippengerCtx::CreateDefault<ScalarField>(size);
+    size_t chunks_bytes = 2 * chunk_size_ * sizeof(PointTy);
+    while (ctx.window_bits > 1 && GetBucketsBytes(ctx) > chunks_bytes) {
+      ctx = PippengerCtx::Create<ScalarField>(size, ctx.window_bits - 1);
+    }
+    return ctx;
+  }
+
+  // The digits of the last window can be as large as 2^|window_bits|, which
+  // needs twice the buckets of the others.
+  static size_t GetBucketSize(const PippengerCtx& ctx, size_t window_index) {
+    if (window_index == ctx.window_count - 1) {
+      return size_t{1} << ctx.window_bits;
+    } else {
+      return size_t{1} << (ctx.window_bits - 1);
+    }
+  }
+
+  static size_t GetBucketsBytes(const PippengerCtx& ctx) {
+    return (ctx.window_count + 1) * GetBucketSize(ctx, 0) * sizeof(Bucket);
+  }
+
+  static bool ReadChunk(base::File* file, int64_t offset,
+                        absl::Span<PointTy> bases) {
+    int bytes = static_cast<int>(bases.size() * sizeof(PointTy));
+    if (file->Read(offset, reinterpret_cast<char*>(bases.data()), bytes) !=
+        bytes) {
+      LOG(ERROR) << "Failed to read bases at " << offset;
+      return false;
+    }
+    return true;
+  }
+
+  template <typename Digit>
+  bool DoRun(base::File* file, int64_t offset,
+             absl::Span<const ScalarField> scalars, Bucket* ret) {
+    std::vector<std::vector<Bucket>> buckets =
+        base::CreateVector(ctx_.window_count, [this](size_t i) {
+          return base::CreateVector(GetBucketSize(ctx_, i), Bucket::Zero());
+        });
+
+    size_t size = scalars.size();
+    size_t chunk_count = (size + chunk_size_ - 1) / chunk_size_;
+    auto get_chunk_size = [this, size](size_t chunk_index) {
+      return std::min(chunk_size_, size - chunk_index * chunk_size_);
+    };
+
+    std::vector<PointTy> buffers[2] = {std::vector<PointTy>(chunk_size_),
+                                       std::vector<PointTy>(chunk_size_)};
+    auto read_chunk = [this, file, offset, &get_chunk_size,
+                       &buffers](size_t chunk_index) {
+      int64_t chunk_offset = chunk_index * chunk_size_ * sizeof(PointTy);
+      return ReadChunk(file, offset + chunk_offset,
+                       absl::MakeSpan(buffers[chunk_index % 2])
+                           .first(get_chunk_size(chunk_index)));
+    };
+    if (!read_chunk(0)) return false;
+
+    for (size_t i = 0; i < chunk_count; ++i) {
+      bool read = true;
+      std::thread reader;
+      if (i + 1 < chunk_count) {
+        reader = std::thread([&read, &read_chunk, i]() {
+          read = read_chunk(i + 1);
+        });
+      }
+
+      absl::Span<const ScalarField> chunk_scalars =
+          scalars.subspan(i * chunk_size_, get_chunk_size(i));
+      absl::Span<const PointTy> chunk_bases =
+          absl::MakeConstSpan(buffers[i % 2]).first(chunk_scalars.size());
+      MSMPhaseTimer timer(stats_, MSMPhase::kDigitDecomposition);
+      WindowDigits<Digit> digits = WindowDigits<Digit>::Decompose(
+          chunk_scalars.begin(), chunk_scalars.size(), ctx_.window_bits,
+          ctx_.window_count, /*parallel=*/true);
+      timer.Stop();
+      OPENMP_PARALLEL_FOR(size_t j = 0; j < ctx_.window_count; ++j) {
+        AccumulateChunk(chunk_bases, digits.GetWindow(j), buckets[j]);
+      }
+
+      if (reader.joinable()) reader.join();
+      if (!read) return false;
+    }
+
+    std::vector<Bucket> window_sums(ctx_.window_count);
+    {
+      MSMPhaseTimer timer(stats_, MSMPhase::kBucketReduction);
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < ctx_.window_count; ++i) {
+        window_sums[i] =
+            this->AccumulateBuckets(absl::MakeConstSpan(buckets[i]));
+      }
+    }
+    MSMPhaseTimer timer(stats_, MSMPhase::kWindowCombine);
+    *ret = this->AccumulateWindowSums(absl::MakeConstSpan(window_sums),
+                                      ctx_.window_bits);
+    return true;
+  }
+
+  template <typename Digit>
+  void AccumulateChunk(absl::Span<const PointTy> bases,
+                       absl::Span<const Digit> window_digits,
+                       std::vector<Bucket>& buckets) {
+    MSMPhaseTimer timer(stats_, MSMPhase::kBucketAccumulation);
+    for (size_t i = 0; i < bases.size(); ++i) {
+      Digit digit = window_digits[i];
+      if (digit > 0) {
+        buckets[digit - 1] += bases[i];
+      } else if (digit < 0) {
+        buckets[-digit - 1] -= bases[i];
+      }
+    }
+  }
+
+  size_t chunk_size_ = kDefaultChunkSize;
+  PippengerCtx ctx_;
+  MSMStats* stats_ = nullptr;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_ELLIPTIC_CURVES_MSM_STREAMING_MSM_H_
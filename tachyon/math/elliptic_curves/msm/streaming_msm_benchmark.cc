@@ -0,0 +1,94 @@
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/base/containers/container_util.h"
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/msm/streaming_msm.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+// Returns the peak resident memory of the process in MiB. Since it never goes
+// down, it's the largest one of the benchmarks run so far, and the in-memory
+// ones are run last.
+double GetPeakRSSInMiB() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1024.0;
+}
+
+}  // namespace
+
+// Runs an MSM of 2^|state.range(0)| terms over bases in a file, holding at
+// most 2^|state.range(1)| bases in memory at a time. The bases are written
+// into the file chunk by chunk as well, so that they are never in memory at
+// once.
+template <typename PointTy>
+void BM_StreamingMSM(benchmark::State& state) {
+  using ScalarField = typename PointTy::ScalarField;
+  using Bucket = typename StreamingMSM<PointTy>::Bucket;
+
+  PointTy::Curve::Init();
+  size_t size = size_t{1} << state.range(0);
+  size_t chunk_size = size_t{1} << state.range(1);
+
+  base::ScopedTempDir temp_dir;
+  CHECK(temp_dir.CreateUniqueTempDir());
+  base::FilePath path = temp_dir.GetPath().Append("bases");
+  {
+    base::File file(path,
+                    base::File::FLAG_CREATE_ALWAYS | base::File::FLAG_WRITE);
+    CHECK(file.IsValid());
+    for (size_t i = 0; i < size; i += chunk_size) {
+      std::vector<PointTy> bases = CreatePseudoRandomPoints<PointTy>(
+          std::min(chunk_size, size - i));
+      CHECK(file.WriteAndCheck(
+          i * sizeof(PointTy),
+          absl::MakeConstSpan(reinterpret_cast<const uint8_t*>(bases.data()),
+                              bases.size() * sizeof(PointTy))));
+    }
+  }
+  std::vector<ScalarField> scalars =
+      base::CreateVector(size, []() { return ScalarField::Random(); });
+
+  base::File file(path, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  CHECK(file.IsValid());
+  StreamingMSM<PointTy> msm;
+  msm.SetChunkSize(chunk_size);
+  Bucket ret;
+  for (auto _ : state) {
+    CHECK(msm.Run(&file, 0, scalars, &ret));
+  }
+  benchmark::DoNotOptimize(ret);
+  state.counters["peak_rss_mib"] = GetPeakRSSInMiB();
+}
+
+// Same as |BM_StreamingMSM|, but with the whole bases in memory.
+template <typename PointTy>
+void BM_InMemoryMSM(benchmark::State& state) {
+  using Bucket = typename VariableBaseMSM<PointTy>::Bucket;
+
+  PointTy::Curve::Init();
+  MSMTestSet<PointTy> test_set = MSMTestSet<PointTy>::Random(
+      size_t{1} << state.range(0), MSMMethod::kNone);
+  VariableBaseMSM<PointTy> msm;
+  Bucket ret;
+  for (auto _ : state) {
+    CHECK(msm.Run(test_set.bases, test_set.scalars, &ret));
+  }
+  benchmark::DoNotOptimize(ret);
+  state.counters["peak_rss_mib"] = GetPeakRSSInMiB();
+}
+
+BENCHMARK_TEMPLATE(BM_StreamingMSM, bn254::G1AffinePoint)
+    ->ArgsProduct({{16, 18, 20}, {12, 14}});
+BENCHMARK_TEMPLATE(BM_InMemoryMSM, bn254::G1AffinePoint)->DenseRange(16, 20, 2);
+
+}  // namespace tachyon::math
@@ -0,0 +1,106 @@
+#include "tachyon/math/elliptic_curves/msm/streaming_msm.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/base/files/scoped_temp_dir.h"
+#include "tachyon/math/elliptic_curves/bls/bls12_381/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
+#include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
+
+namespace tachyon::math {
+
+namespace {
+
+const size_t kSize = 100;
+
+template <typename PointTy>
+class StreamingMSMTest : public testing::Test {
+ public:
+  static void SetUpTestSuite() { PointTy::Curve::Init(); }
+
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    path_ = temp_dir_.GetPath().Append("bases");
+  }
+
+ protected:
+  base::ScopedTempDir temp_dir_;
+  base::FilePath path_;
+};
+
+}  // namespace
+
+using PointTypes =
+    testing::Types<bn254::G1AffinePoint, bn254::G1JacobianPoint,
+                   bls12_381::G1AffinePoint, bn254::G2AffinePoint>;
+TYPED_TEST_SUITE(StreamingMSMTest, PointTypes);
+
+TYPED_TEST(StreamingMSMTest, Run) {
+  using PointTy = TypeParam;
+  using Bucket = typename StreamingMSM<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNaive);
+  ASSERT_TRUE(StreamingMSM<PointTy>::WriteBases(this->path_, test_set.bases));
+  base::File file(this->path_, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  ASSERT_TRUE(file.IsValid());
+
+  // The last chunk of 7 and 33 is shorter than the others, and |kSize| runs
+  // in a single chunk.
+  for (size_t chunk_size : {size_t{1}, size_t{7}, size_t{33}, kSize}) {
+    SCOPED_TRACE(chunk_size);
+    StreamingMSM<PointTy> msm;
+    msm.SetChunkSize(chunk_size);
+    Bucket ret;
+    ASSERT_TRUE(msm.Run(&file, 0, test_set.scalars, &ret));
+    EXPECT_EQ(ret, test_set.answer);
+  }
+}
+
+TYPED_TEST(StreamingMSMTest, RunWithOffset) {
+  using PointTy = TypeParam;
+  using Bucket = typename StreamingMSM<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+  ASSERT_TRUE(StreamingMSM<PointTy>::WriteBases(this->path_, test_set.bases));
+  base::File file(this->path_, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  ASSERT_TRUE(file.IsValid());
+
+  // Runs over the bases after the first 10 ones.
+  std::vector<PointTy> bases(test_set.bases.begin() + 10,
+                             test_set.bases.end());
+  std::vector<typename PointTy::ScalarField> scalars(
+      test_set.scalars.begin() + 10, test_set.scalars.end());
+  VariableBaseMSM<PointTy> expected_msm;
+  Bucket expected;
+  ASSERT_TRUE(expected_msm.Run(bases, scalars, &expected));
+
+  StreamingMSM<PointTy> msm;
+  msm.SetChunkSize(16);
+  Bucket ret;
+  ASSERT_TRUE(msm.Run(&file, 10 * sizeof(PointTy), scalars, &ret));
+  EXPECT_EQ(ret, expected);
+}
+
+TYPED_TEST(StreamingMSMTest, RunWithShortFile) {
+  using PointTy = TypeParam;
+  using Bucket = typename StreamingMSM<PointTy>::Bucket;
+
+  MSMTestSet<PointTy> test_set =
+      MSMTestSet<PointTy>::Random(kSize, MSMMethod::kNone);
+  ASSERT_TRUE(StreamingMSM<PointTy>::WriteBases(
+      this->path_, absl::MakeConstSpan(test_set.bases).first(kSize - 1)));
+  base::File file(this->path_, base::File::FLAG_OPEN | base::File::FLAG_READ);
+  ASSERT_TRUE(file.IsValid());
+
+  StreamingMSM<PointTy> msm;
+  msm.SetChunkSize(16);
+  Bucket ret;
+  EXPECT_FALSE(msm.Run(&file, 0, test_set.scalars, &ret));
+}
+
+}  // namespace tachyon::math
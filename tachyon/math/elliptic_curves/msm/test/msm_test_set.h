@@ -1,10 +1,14 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_TEST_MSM_TEST_SET_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_TEST_MSM_TEST_SET_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <vector>
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/files/file_util.h"
+#include "tachyon/base/random.h"
 #include "tachyon/math/base/semigroups.h"
 #include "tachyon/math/elliptic_curves/msm/variable_base_msm.h"
 #include "tachyon/math/elliptic_curves/point_conversions.h"
@@ -50,6 +54,30 @@ struct MSMTestSet {
     return test_set;
   }
 
+  // Mixes the scalars which are common in witnesses, zeros, ones, short
+  // scalars of 8 to 64 bits and full ones, in about the same proportions.
+  static MSMTestSet Sparse(size_t size, MSMMethod method) {
+    MSMTestSet test_set;
+    test_set.bases = CreatePseudoRandomPoints<PointTy>(size);
+    test_set.scalars = base::CreateVector(size, []() {
+      switch (base::Uniform(base::Range<size_t>::Until(4))) {
+        case 0:
+          return ScalarField::Zero();
+        case 1:
+          return ScalarField::One();
+        case 2: {
+          uint64_t value = absl::Uniform<uint64_t>(base::GetAbslBitGen());
+          return ScalarField(value >>
+                             base::Uniform(base::Range<size_t>::Until(57)));
+        }
+        default:
+          return ScalarField::Random();
+      }
+    });
+    test_set.ComputeAnswer(method);
+    return test_set;
+  }
+
   static MSMTestSet Easy(size_t size, MSMMethod method) {
     MSMTestSet test_set;
     test_set.bases =
@@ -1,9 +1,23 @@
 #ifndef TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 #define TACHYON_MATH_ELLIPTIC_CURVES_MSM_VARIABLE_BASE_MSM_H_
 
+#include <stddef.h>
+
+#include <algorithm>
+#include <iterator>
 #include <utility>
+#include <vector>
+
+#include "absl/types/span.h"
 
+#include "tachyon/base/logging.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/cuzk/cuzk_cpu.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/msm_algorithm_kind.h"
 #include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_adapter.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/pippenger/pippenger_ctx.h"
+#include "tachyon/math/elliptic_curves/msm/algorithms/straus/straus.h"
+#include "tachyon/math/elliptic_curves/msm/msm_stats.h"
+#include "tachyon/math/elliptic_curves/msm/small_scalar_msm.h"
 
 namespace tachyon::math {
 template <typename PointTy>
@@ -12,19 +26,62 @@ class VariableBaseMSM {
   using ScalarField = typename PointTy::ScalarField;
   using Bucket = typename Pippenger<PointTy>::Bucket;
 
+  // Up to this size, |Straus| runs instead of Pippenger, whose setup and
+  // reduction of buckets cost more than the additions of such small MSMs.
+  // This is the crossover measured by straus_benchmark on a single core.
+  // |Straus| runs on a single thread while Pippenger runs its windows on
+  // every thread, so the crossover can be lower on more cores.
+  constexpr static size_t kMaxStrausSize = 64;
+
+  // |kind| is either |MSMAlgorithmKind::kPippenger| or
+  // |MSMAlgorithmKind::kCUZK|, which runs |CUZKCpu|. Bellman MSM only runs on
+  // GPU. See variable_base_msm_gpu.h.
+  explicit VariableBaseMSM(
+      MSMAlgorithmKind kind = MSMAlgorithmKind::kPippenger)
+      : kind_(kind) {}
+
+  MSMAlgorithmKind kind() const { return kind_; }
+
+  // See |Pippenger::SetStats()|. Only Pippenger, which runs for more than
+  // |kMaxStrausSize| terms with |MSMAlgorithmKind::kPippenger|, adds to
+  // |stats|.
+  void SetStats(MSMStats* stats) { stats_ = stats; }
+
   // MSM(Multi-Scalar Multiplication): s₀ * g₀ + s₁ * g₁ + ... + sₙ * gₙ
   // Variable-base MSM is an operation that multiplies different base points
   // with respective scalars, unlike the Fixed-base MSM, which uses the same
   // base point for all multiplications.
-  // This implementation uses Pippenger's algorithm to compute the MSM.
+  // This implementation uses Pippenger's algorithm to compute the MSM. Zeros,
+  // ones and short scalars take a faster path. See small_scalar_msm.h. MSMs of
+  // up to |kMaxStrausSize| terms use Straus's algorithm. See straus.h.
   template <typename BaseInputIterator, typename ScalarInputIterator>
   bool Run(BaseInputIterator bases_first, BaseInputIterator bases_last,
            ScalarInputIterator scalars_first, ScalarInputIterator scalars_last,
            Bucket* ret) {
-    PippengerAdapter<PointTy> pippenger;
-    return pippenger.Run(std::move(bases_first), std::move(bases_last),
+    switch (kind_) {
+      case MSMAlgorithmKind::kPippenger: {
+        if (static_cast<size_t>(std::distance(bases_first, bases_last)) <=
+            kMaxStrausSize) {
+          Straus<PointTy> msm;
+          return msm.Run(std::move(bases_first), std::move(bases_last),
                          std::move(scalars_first), std::move(scalars_last),
                          ret);
+        }
+        SmallScalarMSM<PointTy> msm;
+        msm.SetMSMStats(stats_);
+        return msm.Run(std::move(bases_first), std::move(bases_last),
+                       std::move(scalars_first), std::move(scalars_last), ret);
+      }
+      case MSMAlgorithmKind::kCUZK: {
+        CUZKCpu<PointTy> msm;
+        return msm.Run(std::move(bases_first), std::move(bases_last),
+                       std::move(scalars_first), std::move(scalars_last), ret);
+      }
+      case MSMAlgorithmKind::kBellmanMSM:
+        break;
+    }
+    LOG(ERROR) << "Bellman MSM is not supported on CPU";
+    return false;
   }
 
   template <typename BaseContainer, typename ScalarContainer>
@@ -33,6 +90,88 @@ class VariableBaseMSM {
     return Run(std::begin(bases), std::end(bases), std::begin(scalars),
                std::end(scalars), ret);
   }
+
+  // Updates |prev|, the MSM over |bases| before the scalars at |indices|
+  // changed from |old_scalars| to the ones in |scalars|, into the MSM over
+  // |bases| and |scalars|:
+  //
+  //   prev + Σᵢ (scalars[indicesᵢ] - old_scalarsᵢ) * bases[indicesᵢ]
+  //
+  // which is an MSM over the changed bases alone. When too many scalars
+  // changed for this to pay off, see |ShouldRunDelta()|, the MSM over |bases|
+  // and |scalars| is computed from scratch instead. The arguments are checked
+  // by |ValidateDeltaArgs()| either way.
+  template <typename BaseContainer, typename ScalarContainer>
+  bool RunDelta(const BaseContainer& bases, const ScalarContainer& scalars,
+                absl::Span<const size_t> indices,
+                absl::Span<const ScalarField> old_scalars, const Bucket& prev,
+                Bucket* ret) {
+    size_t size = std::size(scalars);
+    if (std::size(bases) != size) {
+      LOG(ERROR) << "bases_size and scalars_size don't match";
+      return false;
+    }
+    if (!ValidateDeltaArgs(size, indices, old_scalars.size())) return false;
+    if (!ShouldRunDelta(size, indices.size())) {
+      return Run(bases, scalars, ret);
+    }
+
+    std::vector<PointTy> delta_bases(indices.size());
+    std::vector<ScalarField> delta_scalars(indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      size_t index = indices[i];
+      delta_bases[i] = *(std::begin(bases) + index);
+      delta_scalars[i] = *(std::begin(scalars) + index) - old_scalars[i];
+    }
+    Bucket delta;
+    if (!Run(delta_bases, delta_scalars, &delta)) return false;
+    *ret = prev + delta;
+    return true;
+  }
+
+  // Returns true if |indices| and |old_scalars_size| are valid for a
+  // |RunDelta()| over |size| terms: there are as many old scalars as indices,
+  // and every index is less than |size| and appears only once. A duplicate
+  // would add its delta twice.
+  static bool ValidateDeltaArgs(size_t size, absl::Span<const size_t> indices,
+                                size_t old_scalars_size) {
+    if (indices.size() != old_scalars_size) {
+      LOG(ERROR) << "indices_size and old_scalars_size don't match";
+      return false;
+    }
+    if (indices.empty()) return true;
+    std::vector<size_t> sorted_indices(indices.begin(), indices.end());
+    std::sort(sorted_indices.begin(), sorted_indices.end());
+    if (sorted_indices.back() >= size) {
+      LOG(ERROR) << "Index out of range: " << sorted_indices.back()
+                 << " >= " << size;
+      return false;
+    }
+    auto it = std::adjacent_find(sorted_indices.begin(), sorted_indices.end());
+    if (it != sorted_indices.end()) {
+      LOG(ERROR) << "Duplicate index: " << *it;
+      return false;
+    }
+    return true;
+  }
+
+  // Returns true if an MSM over |change_nums| deltas is cheaper than the one
+  // over all of |size| terms. Both are estimated by the bucket additions of
+  // Pippenger, and gathering a delta is counted as one more addition.
+  constexpr static bool ShouldRunDelta(size_t size, size_t change_nums) {
+    return EstimateCost(change_nums) + change_nums < EstimateCost(size);
+  }
+
+ private:
+  // Returns the number of bucket additions of Pippenger over |size| terms.
+  constexpr static size_t EstimateCost(size_t size) {
+    PippengerCtx ctx = PippengerCtx::CreateDefault<ScalarField>(size);
+    return ctx.window_count * (size + ctx.GetWindowLength());
+  }
+
+  MSMAlgorithmKind kind_;
+  // not owned
+  MSMStats* stats_ = nullptr;
 };
 
 }  // namespace tachyon::math
@@ -1,6 +1,10 @@
+#include <vector>
+
+#include "absl/types/span.h"
 #include "gtest/gtest.h"
 
 #include "tachyon/math/elliptic_curves/bn/bn254/g1.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/g2.h"
 #include "tachyon/math/elliptic_curves/msm/test/msm_test_set.h"
 
 namespace tachyon::math {
@@ -28,7 +32,8 @@ class VariableBaseMSMTest : public testing::Test {
 
 using PointTypes =
     testing::Types<bn254::G1AffinePoint, bn254::G1ProjectivePoint,
-                   bn254::G1JacobianPoint, bn254::G1PointXYZZ>;
+                   bn254::G1JacobianPoint, bn254::G1PointXYZZ,
+                   bn254::G2AffinePoint>;
 TYPED_TEST_SUITE(VariableBaseMSMTest, PointTypes);
 
 TYPED_TEST(VariableBaseMSMTest, DoMSM) {
@@ -43,4 +48,91 @@ TYPED_TEST(VariableBaseMSMTest, DoMSM) {
   EXPECT_EQ(ret, test_set.answer);
 }
 
+TYPED_TEST(VariableBaseMSMTest, DoMSMWithCUZK) {
+  using PointTy = TypeParam;
+  using Bucket = typename VariableBaseMSM<PointTy>::Bucket;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  VariableBaseMSM<PointTy> msm(MSMAlgorithmKind::kCUZK);
+  Bucket ret;
+  EXPECT_TRUE(msm.Run(test_set.bases, test_set.scalars, &ret));
+  EXPECT_EQ(ret, test_set.answer);
+
+  VariableBaseMSM<PointTy> bellman_msm(MSMAlgorithmKind::kBellmanMSM);
+  EXPECT_FALSE(bellman_msm.Run(test_set.bases, test_set.scalars, &ret));
+}
+
+TYPED_TEST(VariableBaseMSMTest, RunDelta) {
+  using PointTy = TypeParam;
+  using Bucket = typename VariableBaseMSM<PointTy>::Bucket;
+  using ScalarField = typename PointTy::ScalarField;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  // The first one takes the delta path and the second one recomputes.
+  for (size_t change_nums : {size_t{3}, kSize}) {
+    SCOPED_TRACE(absl::Substitute("change_nums: $0", change_nums));
+    EXPECT_EQ(VariableBaseMSM<PointTy>::ShouldRunDelta(kSize, change_nums),
+              change_nums < kSize);
+
+    std::vector<ScalarField> scalars = test_set.scalars;
+    std::vector<size_t> indices;
+    std::vector<ScalarField> old_scalars;
+    for (size_t i = 0; i < change_nums; ++i) {
+      size_t index = (i * 7) % kSize;
+      indices.push_back(index);
+      old_scalars.push_back(scalars[index]);
+      scalars[index] = ScalarField::Random();
+    }
+
+    VariableBaseMSM<PointTy> msm;
+    Bucket expected;
+    ASSERT_TRUE(msm.Run(test_set.bases, scalars, &expected));
+    Bucket ret;
+    ASSERT_TRUE(msm.RunDelta(test_set.bases, scalars, indices, old_scalars,
+                             test_set.answer, &ret));
+    EXPECT_EQ(ret, expected);
+  }
+}
+
+TYPED_TEST(VariableBaseMSMTest, RunDeltaWithInvalidInputs) {
+  using PointTy = TypeParam;
+  using Bucket = typename VariableBaseMSM<PointTy>::Bucket;
+  using ScalarField = typename PointTy::ScalarField;
+
+  const MSMTestSet<PointTy>& test_set = this->test_set_;
+
+  VariableBaseMSM<PointTy> msm;
+  Bucket ret;
+  std::vector<size_t> indices = {0, kSize};
+  std::vector<ScalarField> old_scalars = {ScalarField::One()};
+  EXPECT_FALSE(msm.RunDelta(test_set.bases, test_set.scalars, indices,
+                            old_scalars, test_set.answer, &ret));
+  old_scalars.push_back(ScalarField::One());
+  EXPECT_FALSE(msm.RunDelta(test_set.bases, test_set.scalars, indices,
+                            old_scalars, test_set.answer, &ret));
+
+  // A duplicate index on the delta path.
+  indices = {3, 3};
+  ASSERT_TRUE(VariableBaseMSM<PointTy>::ShouldRunDelta(kSize, indices.size()));
+  EXPECT_FALSE(msm.RunDelta(test_set.bases, test_set.scalars, indices,
+                            old_scalars, test_set.answer, &ret));
+
+  // An out of range index and a duplicate index on the path which recomputes
+  // from scratch.
+  indices.clear();
+  for (size_t i = 0; i < kSize; ++i) {
+    indices.push_back(i);
+  }
+  ASSERT_FALSE(VariableBaseMSM<PointTy>::ShouldRunDelta(kSize, indices.size()));
+  old_scalars = std::vector<ScalarField>(kSize, ScalarField::One());
+  indices.back() = kSize;
+  EXPECT_FALSE(msm.RunDelta(test_set.bases, test_set.scalars, indices,
+                            old_scalars, test_set.answer, &ret));
+  indices.back() = 0;
+  EXPECT_FALSE(msm.RunDelta(test_set.bases, test_set.scalars, indices,
+                            old_scalars, test_set.answer, &ret));
+}
+
 }  // namespace tachyon::math
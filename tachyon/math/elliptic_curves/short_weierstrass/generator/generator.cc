@@ -30,10 +30,88 @@ struct GenerationConfig : public build::CcWriter {
   std::string lambda;
   std::vector<std::string> glv_coefficients;
 
+  std::string GenerateGLVConstants() const;
   int GenerateConfigHdr() const;
   int GenerateConfigGpuHdr() const;
 };
 
+namespace {
+
+std::string GenerateBigInt(size_t limb_nums, const mpz_class& value) {
+  return absl::Substitute("BigInt<$0>({$1})", limb_nums,
+                          math::MpzClassToString(value));
+}
+
+}  // namespace
+
+// Emits |kGLVCoeffs| in a sign-magnitude form together with the constants for
+// Babai rounding used by |GLVDecomposition|. The scalar field modulus r is the
+// determinant of the lattice basis |kGLVCoeffs|, so it doesn't need to be
+// given separately.
+std::string GenerationConfig::GenerateGLVConstants() const {
+  CHECK_EQ(glv_coefficients.size(), size_t{4});
+  std::vector<mpz_class> coeffs =
+      base::Map(glv_coefficients, [](const std::string& coeff) {
+        std::string_view value = coeff;
+        bool is_negative = base::ConsumePrefix(&value, "-");
+        mpz_class ret = math::gmp::FromDecString(value);
+        return is_negative ? mpz_class(-ret) : ret;
+      });
+  mpz_class r =
+      math::gmp::GetAbs(coeffs[0] * coeffs[3] - coeffs[1] * coeffs[2]);
+  size_t limb_nums = math::gmp::GetLimbSize(r);
+  size_t shift = 64 * (limb_nums + 1);
+
+  // round(2^|shift| * n₂₂ / r) and round(2^|shift| * -n₁₂ / r)
+  mpz_class numerators[] = {coeffs[3], -coeffs[1]};
+  std::vector<std::string> rounding_signs;
+  std::vector<std::string> rounding_constants;
+  for (const mpz_class& numerator : numerators) {
+    mpz_class scaled = math::gmp::GetAbs(numerator) << shift;
+    mpz_class rounded = (scaled + r / 2) / r;
+    CHECK_LE(math::gmp::GetLimbSize(rounded), limb_nums);
+    rounding_signs.push_back(
+        base::BoolToString(math::gmp::IsNegative(numerator)));
+    rounding_constants.push_back(GenerateBigInt(limb_nums, rounded));
+  }
+
+  std::vector<std::string> coeff_signs;
+  std::vector<std::string> coeff_abs;
+  for (const mpz_class& coeff : coeffs) {
+    mpz_class abs = math::gmp::GetAbs(coeff);
+    CHECK_LE(math::gmp::GetLimbSize(abs), limb_nums);
+    coeff_signs.push_back(base::BoolToString(math::gmp::IsNegative(coeff)));
+    coeff_abs.push_back(GenerateBigInt(limb_nums, abs));
+  }
+
+  std::vector<std::string_view> tpl = {
+      // clang-format off
+      "",
+      "  // |kGLVCoeffs| in a sign-magnitude form.",
+      "  constexpr static bool kGLVCoeffsIsNegative[4] = {%{coeff_signs}};",
+      "  constexpr static BigInt<%{n}> kGLVCoeffsAbs[4] = {",
+      "    %{coeff_abs}",
+      "  };",
+      "  // round(2^(64 * (%{n} + 1)) * n₂₂ / r) and round(2^(64 * (%{n} + 1)) * -n₁₂ / r)",
+      "  // in a sign-magnitude form, where [[n₁₁, n₁₂], [n₂₁, n₂₂]] is |kGLVCoeffs|.",
+      "  constexpr static bool kGLVRoundingConstantsIsNegative[2] = {%{rounding_signs}};",
+      "  constexpr static BigInt<%{n}> kGLVRoundingConstantsAbs[2] = {",
+      "    %{rounding_constants}",
+      "  };",
+      // clang-format on
+  };
+  return absl::StrReplaceAll(
+      absl::StrJoin(tpl, "\n"),
+      {
+          {"%{n}", base::NumberToString(limb_nums)},
+          {"%{coeff_signs}", absl::StrJoin(coeff_signs, ", ")},
+          {"%{coeff_abs}", absl::StrJoin(coeff_abs, ",\n    ")},
+          {"%{rounding_signs}", absl::StrJoin(rounding_signs, ", ")},
+          {"%{rounding_constants}",
+           absl::StrJoin(rounding_constants, ",\n    ")},
+      });
+}
+
 int GenerationConfig::GenerateConfigHdr() const {
   std::vector<std::string_view> tpl = {
       // clang-format off
@@ -71,6 +149,7 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  static BaseField kEndomorphismCoefficient;",
       "  static ScalarField kLambda;",
       "  static mpz_class kGLVCoeffs[4];",
+      "%{glv_constants}",
       "",
       "  static void Init() {",
       "%{a_init}",
@@ -115,10 +194,10 @@ int GenerationConfig::GenerateConfigHdr() const {
       "using %{class}PointXYZZ = PointXYZZ<%{class}Curve>;",
       "#if defined(TACHYON_GMP_BACKEND)",
       "using %{class}CurveGmp = SWCurve<%{class}CurveConfig<%{base_field}, %{scalar_field}>>;",
-      "using %{class}AffinePointGmp = AffinePoint<%{class}CurveGmp>;",
-      "using %{class}ProjectivePointGmp = ProjectivePoint<%{class}CurveGmp>;",
-      "using %{class}JacobianPointGmp = JacobianPoint<%{class}CurveGmp>;",
-      "using %{class}PointXYZZGmp = PointXYZZ<%{class}CurveGmp>;",
+      "using %{class}AffinePointGmp = math::AffinePoint<%{class}CurveGmp>;",
+      "using %{class}ProjectivePointGmp = math::ProjectivePoint<%{class}CurveGmp>;",
+      "using %{class}JacobianPointGmp = math::JacobianPoint<%{class}CurveGmp>;",
+      "using %{class}PointXYZZGmp = math::PointXYZZ<%{class}CurveGmp>;",
       "#endif  // defined(TACHYON_GMP_BACKEND)",
       "",
       "}  // namespace %{namespace}",
@@ -142,6 +221,14 @@ int GenerationConfig::GenerateConfigHdr() const {
         break;
       }
     }
+    for (size_t j = 0; j < tpl.size(); ++j) {
+      size_t idx = tpl[j].find("%{glv_constants}");
+      if (idx != std::string::npos) {
+        auto it = tpl.begin() + j;
+        tpl.erase(it);
+        break;
+      }
+    }
     for (size_t j = 0; j < tpl.size(); ++j) {
       size_t idx = tpl[j].find("endomorphism_coefficient_init");
       if (idx != std::string::npos) {
@@ -259,6 +346,7 @@ int GenerationConfig::GenerateConfigHdr() const {
         endomorphism_coefficient_init;
     replacements["%{lambda_init}"] = lambda_init;
     replacements["%{glv_coeffs_init}"] = glv_coeffs_init;
+    replacements["%{glv_constants}"] = GenerateGLVConstants();
   }
 
   std::string content = absl::StrReplaceAll(tpl_content, replacements);
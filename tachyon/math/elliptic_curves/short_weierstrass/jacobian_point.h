@@ -4,9 +4,11 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "absl/strings/substitute.h"
 
+#include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
 #include "tachyon/math/base/groups.h"
 #include "tachyon/math/elliptic_curves/affine_point.h"
@@ -143,6 +145,33 @@ class JacobianPoint<_Curve, std::enable_if_t<_Curve::kIsSWCurve>> final
     }
   }
 
+  // Converts |jacobian_points| into affine coordinates sharing a single
+  // inversion through |BaseField::BatchInverseInPlace()|.
+  template <typename JacobianContainer, typename AffineContainer>
+  static bool BatchToAffine(const JacobianContainer& jacobian_points,
+                            AffineContainer* affine_points) {
+    if (std::size(jacobian_points) != std::size(*affine_points)) {
+      LOG(ERROR)
+          << "Size of |jacobian_points| and |affine_points| do not match";
+      return false;
+    }
+    std::vector<BaseField> z_invs = base::Map(
+        jacobian_points, [](const JacobianPoint& point) { return point.z_; });
+    if (!BaseField::BatchInverseInPlace(z_invs)) return false;
+    for (size_t i = 0; i < z_invs.size(); ++i) {
+      const JacobianPoint& point = jacobian_points[i];
+      const BaseField& z_inv = z_invs[i];
+      if (z_inv.IsZero()) {
+        (*affine_points)[i] = AffinePoint<Curve>::Zero();
+      } else {
+        BaseField z_inv_square = z_inv.Square();
+        (*affine_points)[i] = {point.x_ * z_inv_square,
+                               point.y_ * z_inv_square * z_inv};
+      }
+    }
+    return true;
+  }
+
   // The jacobian point X, Y, Z is represented in the projective
   // coordinates as X*Z, Y, Z³.
   constexpr ProjectivePoint<Curve> ToProjective() const {
@@ -194,6 +194,29 @@ TYPED_TEST(JacobianPointTest, ToAffine) {
       AffinePointTy(BaseField(4), BaseField(5)));
 }
 
+TYPED_TEST(JacobianPointTest, BatchToAffine) {
+  using JacobianPointTy = TypeParam;
+  using AffinePointTy = typename JacobianPointTy::AffinePointTy;
+  using BaseField = typename JacobianPointTy::BaseField;
+
+  std::vector<JacobianPointTy> jacobian_points = {
+      JacobianPointTy(BaseField(1), BaseField(2), BaseField(0)),
+      JacobianPointTy(BaseField(1), BaseField(2), BaseField(1)),
+      JacobianPointTy(BaseField(1), BaseField(2), BaseField(3)),
+  };
+  std::vector<AffinePointTy> affine_points;
+  EXPECT_FALSE(JacobianPointTy::BatchToAffine(jacobian_points, &affine_points));
+
+  affine_points.resize(jacobian_points.size());
+  ASSERT_TRUE(JacobianPointTy::BatchToAffine(jacobian_points, &affine_points));
+  std::vector<AffinePointTy> expected = {
+      AffinePointTy::Zero(),
+      AffinePointTy(BaseField(1), BaseField(2)),
+      AffinePointTy(BaseField(4), BaseField(5)),
+  };
+  EXPECT_EQ(affine_points, expected);
+}
+
 TYPED_TEST(JacobianPointTest, ToProjective) {
   using JacobianPointTy = TypeParam;
   using ProjectivePointTy = typename JacobianPointTy::ProjectivePointTy;
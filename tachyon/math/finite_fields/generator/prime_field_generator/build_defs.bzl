@@ -24,6 +24,9 @@ def _generate_prime_field_impl(ctx):
     if len(ctx.attr.special_prime_override):
         arguments.append("--special_prime_override=%s" % (ctx.attr.special_prime_override))
 
+    if ctx.attr.use_safegcd_inverse:
+        arguments.append("--use_safegcd_inverse")
+
     ctx.actions.run(
         tools = [ctx.executable._tool],
         executable = ctx.executable._tool,
@@ -45,6 +48,7 @@ generate_prime_field = rule(
         "small_subgroup_adicity": attr.string(),
         "hdr_include_override": attr.string(),
         "special_prime_override": attr.string(),
+        "use_safegcd_inverse": attr.bool(default = False),
         "_tool": attr.label(
             # TODO(chokobole): Change it to "exec" we can build it on macos.
             cfg = "target",
@@ -65,6 +69,7 @@ def generate_prime_fields(
         small_subgroup_adicity = "",
         hdr_include_override = "",
         special_prime_override = "",
+        use_safegcd_inverse = False,
         deps = [],
         **kwargs):
     for n in [
@@ -80,6 +85,7 @@ def generate_prime_fields(
             small_subgroup_adicity = small_subgroup_adicity,
             hdr_include_override = hdr_include_override,
             special_prime_override = special_prime_override,
+            use_safegcd_inverse = use_safegcd_inverse,
             name = n[0],
             out = n[1],
         )
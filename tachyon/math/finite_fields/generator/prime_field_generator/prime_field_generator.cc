@@ -75,6 +75,7 @@ struct GenerationConfig : public build::CcWriter {
   std::string small_subgroup_adicity;
   std::string hdr_include_override;
   std::string special_prime_override;
+  bool use_safegcd_inverse = false;
 
   int GenerateConfigHdr() const;
   int GenerateConfigCpp() const;
@@ -125,6 +126,7 @@ int GenerationConfig::GenerateConfigHdr() const {
       "  });",
       "  constexpr static uint64_t kInverse64 = UINT64_C(%{inverse64});",
       "  constexpr static uint32_t kInverse32 = %{inverse32};",
+      "  constexpr static bool kUseSafeGcdInverse = %{use_safegcd_inverse};",
       "",
       "  constexpr static BigInt<%{n}> kOne = BigInt<%{n}>({",
       "    %{one_mont_form}",
@@ -298,6 +300,7 @@ int GenerationConfig::GenerateConfigHdr() const {
           {"%{r2}", math::MpzClassToString(modulus_info.r2)},
           {"%{inverse64}", base::NumberToString(modulus_info.inverse64)},
           {"%{inverse32}", base::NumberToString(modulus_info.inverse32)},
+          {"%{use_safegcd_inverse}", base::BoolToString(use_safegcd_inverse)},
           {"%{one_mont_form}", math::MpzClassToMontString(mpz_class(1), m)},
       });
   return WriteHdr(content, false);
@@ -352,6 +355,8 @@ int RealMain(int argc, char** argv) {
       .set_long_name("--hdr_include_override");
   parser.AddFlag<base::StringFlag>(&config.special_prime_override)
       .set_long_name("--special_prime_override");
+  parser.AddFlag<base::BoolFlag>(&config.use_safegcd_inverse)
+      .set_long_name("--use_safegcd_inverse");
 
   std::string error;
   if (!parser.Parse(argc, argv, &error)) {
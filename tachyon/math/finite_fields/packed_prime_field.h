@@ -0,0 +1,252 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
+
+#include <stddef.h>
+
+#include <array>
+#include <type_traits>
+
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/base/bit_iterator.h"
+#include "tachyon/math/finite_fields/packed_prime_field_avx2.h"
+#include "tachyon/math/finite_fields/packed_prime_field_avx512_ifma.h"
+#include "tachyon/math/finite_fields/packed_prime_field_goldilocks_avx2.h"
+#include "tachyon/math/finite_fields/packed_prime_field_goldilocks_avx512.h"
+#include "tachyon/math/finite_fields/prime_field.h"
+
+namespace tachyon::math {
+namespace internal {
+
+// The scalar fallback, which operates on |Lanes| elements one by one.
+template <typename F, size_t Lanes, typename SFINAE = void>
+class PackedPrimeFieldImpl {
+ public:
+  constexpr static bool kIsVectorized = false;
+
+  using Storage = std::array<F, Lanes>;
+
+  static void Load(const F* src, Storage* r) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      (*r)[i] = src[i];
+    }
+  }
+
+  static void Store(const Storage& a, F* dst) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      dst[i] = a[i];
+    }
+  }
+
+  static void Broadcast(const F& value, Storage* r) { r->fill(value); }
+
+  static void Add(const Storage& a, const Storage& b, Storage* r) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      (*r)[i] = a[i] + b[i];
+    }
+  }
+
+  static void Sub(const Storage& a, const Storage& b, Storage* r) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      (*r)[i] = a[i] - b[i];
+    }
+  }
+
+  static void Mul(const Storage& a, const Storage& b, Storage* r) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      (*r)[i] = a[i] * b[i];
+    }
+  }
+
+  static void Square(const Storage& a, Storage* r) {
+    for (size_t i = 0; i < Lanes; ++i) {
+      (*r)[i] = a[i].Square();
+    }
+  }
+};
+
+#if defined(TACHYON_HAS_AVX512_IFMA)
+template <typename Config>
+class PackedPrimeFieldImpl<
+    PrimeField<Config>, 8,
+    std::enable_if_t<!Config::kIsSpecialPrime && PrimeField<Config>::N == 4>>
+    : public PackedPrimeFieldAvx512Ifma<Config> {};
+#endif  // defined(TACHYON_HAS_AVX512_IFMA)
+
+// The scalar multiplication on MULX and ADX beats the AVX2 one, so it isn't
+// used when they are enabled.
+#if defined(TACHYON_HAS_AVX2) && !defined(TACHYON_HAS_MULX_ADX)
+template <typename Config>
+class PackedPrimeFieldImpl<
+    PrimeField<Config>, 4,
+    std::enable_if_t<!Config::kIsSpecialPrime && PrimeField<Config>::N == 4 &&
+                     Config::kModulusHasSpareBit>>
+    : public PackedPrimeFieldAvx2<Config> {};
+#endif  // defined(TACHYON_HAS_AVX2) && !defined(TACHYON_HAS_MULX_ADX)
+
+template <typename Config>
+constexpr bool kIsGoldilocksPrimeField =
+    !Config::kIsSpecialPrime && PrimeField<Config>::N == 1 &&
+    Config::kModulus[0] == kGoldilocksModulus;
+
+#if defined(TACHYON_HAS_AVX512)
+template <typename Config>
+class PackedPrimeFieldImpl<PrimeField<Config>, 8,
+                           std::enable_if_t<kIsGoldilocksPrimeField<Config>>>
+    : public PackedPrimeFieldGoldilocksAvx512<Config> {};
+#endif  // defined(TACHYON_HAS_AVX512)
+
+#if defined(TACHYON_HAS_AVX2)
+template <typename Config>
+class PackedPrimeFieldImpl<PrimeField<Config>, 4,
+                           std::enable_if_t<kIsGoldilocksPrimeField<Config>>>
+    : public PackedPrimeFieldGoldilocksAvx2<Config> {};
+#endif  // defined(TACHYON_HAS_AVX2)
+
+// Returns the widest number of lanes which runs on SIMD instructions for |F|.
+template <typename F>
+constexpr size_t GetDefaultPackedPrimeFieldLanes() {
+  if constexpr (PackedPrimeFieldImpl<F, 8>::kIsVectorized) {
+    return 8;
+  } else {
+    return 4;
+  }
+}
+
+}  // namespace internal
+
+// |PackedPrimeField| holds |Lanes| elements of |F| in a structure-of-arrays
+// layout and adds, subtracts, multiplies and squares all of them at once. For
+// a 4-limb |PrimeField|, it runs on AVX-512 IFMA with 8 lanes and on AVX2 with
+// 4 lanes, if they are enabled, and it falls back to the scalar operations
+// otherwise. AVX2 is skipped when MULX and ADX are enabled. For the Goldilocks
+// |PrimeField|, it runs on AVX-512 with 8 lanes and on AVX2 with 4 lanes. A
+// loop over field elements opts into it by going over |Lanes| elements at a
+// time:
+//
+//   using Packed = PackedPrimeField<F>;
+//   if constexpr (Packed::kIsVectorized) {
+//     for (; i + Packed::kLanes <= size; i += Packed::kLanes) {
+//       (Packed::Load(&a[i]) * Packed::Load(&b[i])).Store(&a[i]);
+//     }
+//   }
+//   for (; i < size; ++i) {
+//     a[i] *= b[i];
+//   }
+template <typename _F,
+          size_t Lanes = internal::GetDefaultPackedPrimeFieldLanes<_F>()>
+class PackedPrimeField {
+ public:
+  using F = _F;
+  using Impl = internal::PackedPrimeFieldImpl<F, Lanes>;
+  using Storage = typename Impl::Storage;
+
+  constexpr static size_t kLanes = Lanes;
+  // True if the operations run on SIMD instructions rather than falling back
+  // to the scalar ones.
+  constexpr static bool kIsVectorized = Impl::kIsVectorized;
+
+  // The lanes are left uninitialized.
+  PackedPrimeField() = default;
+
+  static PackedPrimeField Zero() { return Broadcast(F::Zero()); }
+
+  static PackedPrimeField One() { return Broadcast(F::One()); }
+
+  static PackedPrimeField Broadcast(const F& value) {
+    PackedPrimeField ret;
+    Impl::Broadcast(value, &ret.storage_);
+    return ret;
+  }
+
+  // Loads |Lanes| elements from |src|.
+  static PackedPrimeField Load(const F* src) {
+    PackedPrimeField ret;
+    Impl::Load(src, &ret.storage_);
+    return ret;
+  }
+
+  // Stores |Lanes| elements to |dst|.
+  void Store(F* dst) const { Impl::Store(storage_, dst); }
+
+  std::array<F, Lanes> ToArray() const {
+    std::array<F, Lanes> ret;
+    Store(ret.data());
+    return ret;
+  }
+
+  PackedPrimeField operator+(const PackedPrimeField& other) const {
+    PackedPrimeField ret;
+    Impl::Add(storage_, other.storage_, &ret.storage_);
+    return ret;
+  }
+
+  PackedPrimeField& operator+=(const PackedPrimeField& other) {
+    Impl::Add(storage_, other.storage_, &storage_);
+    return *this;
+  }
+
+  PackedPrimeField operator-(const PackedPrimeField& other) const {
+    PackedPrimeField ret;
+    Impl::Sub(storage_, other.storage_, &ret.storage_);
+    return ret;
+  }
+
+  PackedPrimeField& operator-=(const PackedPrimeField& other) {
+    Impl::Sub(storage_, other.storage_, &storage_);
+    return *this;
+  }
+
+  PackedPrimeField operator*(const PackedPrimeField& other) const {
+    PackedPrimeField ret;
+    Impl::Mul(storage_, other.storage_, &ret.storage_);
+    return ret;
+  }
+
+  PackedPrimeField& operator*=(const PackedPrimeField& other) {
+    Impl::Mul(storage_, other.storage_, &storage_);
+    return *this;
+  }
+
+  PackedPrimeField Square() const {
+    PackedPrimeField ret;
+    Impl::Square(storage_, &ret.storage_);
+    return ret;
+  }
+
+  PackedPrimeField& SquareInPlace() {
+    Impl::Square(storage_, &storage_);
+    return *this;
+  }
+
+  // Square it as much as possible and multiply the remainder.
+  // See |MultiplicativeSemigroup::Pow()|.
+  template <size_t N>
+  PackedPrimeField Pow(const BigInt<N>& exponent) const {
+    PackedPrimeField ret = One();
+    auto it = BitIteratorBE<BigInt<N>>::begin(&exponent, true);
+    auto end = BitIteratorBE<BigInt<N>>::end(&exponent);
+    while (it != end) {
+      ret.SquareInPlace();
+      if (*it) {
+        ret *= *this;
+      }
+      ++it;
+    }
+    return ret;
+  }
+
+  bool operator==(const PackedPrimeField& other) const {
+    return ToArray() == other.ToArray();
+  }
+
+  bool operator!=(const PackedPrimeField& other) const {
+    return !operator==(other);
+  }
+
+ private:
+  Storage storage_;
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_H_
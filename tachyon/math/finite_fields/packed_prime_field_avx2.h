@@ -0,0 +1,240 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX2_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/prime_field.h"
+
+// AVX2 is enabled by -mavx2 or -march of a CPU which has it. See avx2_linux in
+// .bazelrc.
+#if ARCH_CPU_X86_64 && defined(__AVX2__)
+#define TACHYON_HAS_AVX2 1
+#endif
+
+#if defined(TACHYON_HAS_AVX2)
+
+#include <immintrin.h>
+
+namespace tachyon::math::internal {
+
+// Montgomery arithmetic over 4 elements of a 4-limb |PrimeField| at once. An
+// element is split into 8 digits of 32 bits and the i-th digits of the 4
+// elements are put into the 64-bit lanes of |limbs[i]|, so that VPMULUDQ
+// multiplies them lane by lane. Each 64-bit product is added as 2 halves of
+// 32 bits, which leaves room to add up the partial products without carrying.
+// Elements are kept reduced and in the same Montgomery form as |PrimeField|.
+// Since a sum of 2 elements must fit in 256 bits, the modulus must have a
+// spare bit.
+template <typename Config>
+class PackedPrimeFieldAvx2 {
+ public:
+  using F = PrimeField<Config>;
+
+  static_assert(Config::kModulusHasSpareBit);
+  static_assert(sizeof(F) == sizeof(BigInt<4>));
+
+  constexpr static size_t kLanes = 4;
+  constexpr static size_t kLimbNums = 8;
+  constexpr static bool kIsVectorized = true;
+
+  struct Storage {
+    __m256i limbs[kLimbNums];
+  };
+
+  ALWAYS_INLINE static void Load(const F* src, Storage* r) {
+    __m256i v[4];
+    for (size_t i = 0; i < 4; ++i) {
+      v[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    }
+    // w[i] holds the i-th 64-bit limbs of the 4 elements.
+    __m256i w[4];
+    Transpose(v, w);
+    __m256i mask = _mm256_set1_epi64x(kMask32);
+    for (size_t i = 0; i < 4; ++i) {
+      r->limbs[2 * i] = _mm256_and_si256(w[i], mask);
+      r->limbs[2 * i + 1] = _mm256_srli_epi64(w[i], 32);
+    }
+  }
+
+  ALWAYS_INLINE static void Store(const Storage& a, F* dst) {
+    __m256i w[4];
+    for (size_t i = 0; i < 4; ++i) {
+      w[i] = _mm256_or_si256(a.limbs[2 * i],
+                             _mm256_slli_epi64(a.limbs[2 * i + 1], 32));
+    }
+    __m256i v[4];
+    Transpose(w, v);
+    for (size_t i = 0; i < 4; ++i) {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(&dst[i]), v[i]);
+    }
+  }
+
+  ALWAYS_INLINE static void Broadcast(const F& value, Storage* r) {
+    for (size_t i = 0; i < 4; ++i) {
+      r->limbs[2 * i] = _mm256_set1_epi64x(value.value()[i] & kMask32);
+      r->limbs[2 * i + 1] = _mm256_set1_epi64x(value.value()[i] >> 32);
+    }
+  }
+
+  ALWAYS_INLINE static void Add(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m256i t[kLimbNums];
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      t[i] = _mm256_add_epi64(a.limbs[i], b.limbs[i]);
+    }
+    Normalize(t);
+    ReduceOnce(t, r);
+  }
+
+  ALWAYS_INLINE static void Sub(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m256i mask = _mm256_set1_epi64x(kMask32);
+    __m256i t[kLimbNums];
+    __m256i borrow = _mm256_setzero_si256();
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      t[i] = _mm256_sub_epi64(_mm256_sub_epi64(a.limbs[i], b.limbs[i]),
+                              borrow);
+      borrow = _mm256_srli_epi64(t[i], 63);
+      t[i] = _mm256_and_si256(t[i], mask);
+    }
+    // Adds the modulus back where |a| < |b|. The carry out of the top digit
+    // is dropped, which wraps the result around 2²⁵⁶.
+    __m256i negative = _mm256_sub_epi64(_mm256_setzero_si256(), borrow);
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      t[i] = _mm256_add_epi64(
+          t[i], _mm256_and_si256(_mm256_set1_epi64x(Modulus(i)), negative));
+    }
+    Normalize(t);
+    r->limbs[kLimbNums - 1] = _mm256_and_si256(t[kLimbNums - 1], mask);
+    for (size_t i = 0; i < kLimbNums - 1; ++i) {
+      r->limbs[i] = t[i];
+    }
+  }
+
+  ALWAYS_INLINE static void Mul(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m256i t[2 * kLimbNums];
+    for (size_t i = 0; i < 2 * kLimbNums; ++i) {
+      t[i] = _mm256_setzero_si256();
+    }
+#pragma GCC unroll 8
+    for (size_t i = 0; i < kLimbNums; ++i) {
+#pragma GCC unroll 8
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        MulAdd(a.limbs[i], b.limbs[j], &t[i + j]);
+      }
+    }
+    MontgomeryReduce(t, r);
+  }
+
+  ALWAYS_INLINE static void Square(const Storage& a, Storage* r) {
+    __m256i t[2 * kLimbNums];
+    for (size_t i = 0; i < 2 * kLimbNums; ++i) {
+      t[i] = _mm256_setzero_si256();
+    }
+    // Adds the cross products once and doubles them, and then adds the
+    // squares of the digits.
+#pragma GCC unroll 8
+    for (size_t i = 0; i < kLimbNums; ++i) {
+#pragma GCC unroll 8
+      for (size_t j = i + 1; j < kLimbNums; ++j) {
+        MulAdd(a.limbs[i], a.limbs[j], &t[i + j]);
+      }
+    }
+    for (size_t i = 0; i < 2 * kLimbNums; ++i) {
+      t[i] = _mm256_slli_epi64(t[i], 1);
+    }
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      MulAdd(a.limbs[i], a.limbs[i], &t[2 * i]);
+    }
+    MontgomeryReduce(t, r);
+  }
+
+ private:
+  constexpr static uint64_t kMask32 = (uint64_t{1} << 32) - 1;
+
+  constexpr static uint64_t Modulus(size_t i) {
+    return (Config::kModulus[i / 2] >> (32 * (i % 2))) & kMask32;
+  }
+
+  // Transposes the 4 x 4 matrix of 64-bit words in |a|, where a row holds an
+  // element, into |b|, where a row holds a limb of the 4 elements, and vice
+  // versa.
+  ALWAYS_INLINE static void Transpose(const __m256i a[4], __m256i b[4]) {
+    __m256i t0 = _mm256_unpacklo_epi64(a[0], a[1]);
+    __m256i t1 = _mm256_unpackhi_epi64(a[0], a[1]);
+    __m256i t2 = _mm256_unpacklo_epi64(a[2], a[3]);
+    __m256i t3 = _mm256_unpackhi_epi64(a[2], a[3]);
+    b[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+    b[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+    b[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+    b[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+  }
+
+  // Adds |a| * |b| to t[0] and t[1] as 2 halves of 32 bits.
+  ALWAYS_INLINE static void MulAdd(__m256i a, __m256i b, __m256i t[2]) {
+    __m256i product = _mm256_mul_epu32(a, b);
+    t[0] = _mm256_add_epi64(
+        t[0], _mm256_and_si256(product, _mm256_set1_epi64x(kMask32)));
+    t[1] = _mm256_add_epi64(t[1], _mm256_srli_epi64(product, 32));
+  }
+
+  // Carries the bits above 32 of each digit over to the next one.
+  ALWAYS_INLINE static void Normalize(__m256i t[kLimbNums]) {
+    __m256i mask = _mm256_set1_epi64x(kMask32);
+    for (size_t i = 0; i < kLimbNums - 1; ++i) {
+      t[i + 1] = _mm256_add_epi64(t[i + 1], _mm256_srli_epi64(t[i], 32));
+      t[i] = _mm256_and_si256(t[i], mask);
+    }
+  }
+
+  // Subtracts the modulus from |t| in [0, 2 * modulus), where |t| is
+  // normalized.
+  ALWAYS_INLINE static void ReduceOnce(const __m256i t[kLimbNums],
+                                       Storage* r) {
+    __m256i mask = _mm256_set1_epi64x(kMask32);
+    __m256i d[kLimbNums];
+    __m256i borrow = _mm256_setzero_si256();
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      d[i] = _mm256_sub_epi64(
+          _mm256_sub_epi64(t[i], _mm256_set1_epi64x(Modulus(i))), borrow);
+      borrow = _mm256_srli_epi64(d[i], 63);
+      d[i] = _mm256_and_si256(d[i], mask);
+    }
+    __m256i negative = _mm256_sub_epi64(_mm256_setzero_si256(), borrow);
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      r->limbs[i] = _mm256_blendv_epi8(d[i], t[i], negative);
+    }
+  }
+
+  // Computes |t| * 2⁻²⁵⁶ mod modulus, where |t| is a product of 2 reduced
+  // elements. Each digit of |t| can hold more than 32 bits as the partial
+  // products are added without carrying.
+  ALWAYS_INLINE static void MontgomeryReduce(__m256i t[2 * kLimbNums],
+                                             Storage* r) {
+    __m256i inverse = _mm256_set1_epi64x(Config::kInverse32);
+#pragma GCC unroll 8
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      // VPMULUDQ only takes the low 32 bits of each lane, so |m| doesn't need
+      // to be masked.
+      __m256i m = _mm256_mul_epu32(t[i], inverse);
+#pragma GCC unroll 8
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        MulAdd(m, _mm256_set1_epi64x(Modulus(j)), &t[i + j]);
+      }
+      t[i + 1] = _mm256_add_epi64(t[i + 1], _mm256_srli_epi64(t[i], 32));
+    }
+    Normalize(&t[kLimbNums]);
+    ReduceOnce(&t[kLimbNums], r);
+  }
+};
+
+}  // namespace tachyon::math::internal
+
+#endif  // defined(TACHYON_HAS_AVX2)
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX2_H_
@@ -0,0 +1,315 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/prime_field.h"
+
+// AVX-512 IFMA is enabled by -mavx512f -mavx512ifma or -march of a CPU which
+// has it. See avx512_ifma_linux in .bazelrc.
+#if ARCH_CPU_X86_64 && defined(__AVX512F__) && defined(__AVX512IFMA__)
+#define TACHYON_HAS_AVX512_IFMA 1
+#endif
+
+#if defined(TACHYON_HAS_AVX512_IFMA)
+
+#include <immintrin.h>
+
+#include <array>
+
+// GCC 12 warns that the shifts and the multiplications of avx512fintrin.h
+// use an uninitialized variable once they are inlined, which breaks -Werror
+// builds. See https://gcc.gnu.org/bugzilla/show_bug.cgi?id=105593.
+#if defined(COMPILER_GCC) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace tachyon::math::internal {
+
+constexpr uint64_t kMask52 = (uint64_t{1} << 52) - 1;
+
+// Splits a 256-bit |value| into 5 limbs of 52 bits.
+constexpr std::array<uint64_t, 5> ToLimbs52(const BigInt<4>& value) {
+  return {
+      value[0] & kMask52,
+      ((value[0] >> 52) | (value[1] << 12)) & kMask52,
+      ((value[1] >> 40) | (value[2] << 24)) & kMask52,
+      ((value[2] >> 28) | (value[3] << 36)) & kMask52,
+      value[3] >> 16,
+  };
+}
+
+// Montgomery arithmetic over 8 elements of a 4-limb |PrimeField| at once. An
+// element is split into 5 limbs of 52 bits and the i-th limbs of the 8
+// elements are put into the 8 lanes of |limbs[i]|, so that VPMADD52LUQ and
+// VPMADD52HUQ multiply them lane by lane. Elements are kept reduced and in
+// the same Montgomery form as |PrimeField|, where R is 2²⁵⁶, so that
+// |Load()| and |Store()| only move bits around. Since 256 is not a multiple
+// of 52, the reduction takes 4 steps of 52 bits and a last one of 48 bits.
+template <typename Config>
+class PackedPrimeFieldAvx512Ifma {
+ public:
+  using F = PrimeField<Config>;
+
+  static_assert(sizeof(F) == sizeof(BigInt<4>));
+
+  constexpr static size_t kLanes = 8;
+  constexpr static size_t kLimbNums = 5;
+  constexpr static bool kIsVectorized = true;
+
+  struct Storage {
+    __m512i limbs[kLimbNums];
+  };
+
+  ALWAYS_INLINE static void Load(const F* src, Storage* r) {
+    __m512i v[4];
+    for (size_t i = 0; i < 4; ++i) {
+      v[i] = _mm512_loadu_si512(&src[2 * i]);
+    }
+    __m512i w[4];
+    TransposeToLimbs(v, w);
+    __m512i mask = _mm512_set1_epi64(kMask52);
+    r->limbs[0] = _mm512_and_si512(w[0], mask);
+    r->limbs[1] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(w[0], 52),
+                        _mm512_slli_epi64(w[1], 12)),
+        mask);
+    r->limbs[2] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(w[1], 40),
+                        _mm512_slli_epi64(w[2], 24)),
+        mask);
+    r->limbs[3] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(w[2], 28),
+                        _mm512_slli_epi64(w[3], 36)),
+        mask);
+    r->limbs[4] = _mm512_srli_epi64(w[3], 16);
+  }
+
+  ALWAYS_INLINE static void Store(const Storage& a, F* dst) {
+    __m512i w[4];
+    w[0] = _mm512_or_si512(a.limbs[0], _mm512_slli_epi64(a.limbs[1], 52));
+    w[1] = _mm512_or_si512(_mm512_srli_epi64(a.limbs[1], 12),
+                           _mm512_slli_epi64(a.limbs[2], 40));
+    w[2] = _mm512_or_si512(_mm512_srli_epi64(a.limbs[2], 24),
+                           _mm512_slli_epi64(a.limbs[3], 28));
+    w[3] = _mm512_or_si512(_mm512_srli_epi64(a.limbs[3], 36),
+                           _mm512_slli_epi64(a.limbs[4], 16));
+    __m512i v[4];
+    TransposeToElements(w, v);
+    for (size_t i = 0; i < 4; ++i) {
+      _mm512_storeu_si512(&dst[2 * i], v[i]);
+    }
+  }
+
+  ALWAYS_INLINE static void Broadcast(const F& value, Storage* r) {
+    std::array<uint64_t, kLimbNums> limbs = ToLimbs52(value.value());
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      r->limbs[i] = _mm512_set1_epi64(limbs[i]);
+    }
+  }
+
+  ALWAYS_INLINE static void Add(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m512i t[kLimbNums];
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      t[i] = _mm512_add_epi64(a.limbs[i], b.limbs[i]);
+    }
+    Normalize(t);
+    ReduceOnce(t, r);
+  }
+
+  ALWAYS_INLINE static void Sub(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m512i mask = _mm512_set1_epi64(kMask52);
+    __m512i t[kLimbNums];
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      t[i] = _mm512_sub_epi64(a.limbs[i], b.limbs[i]);
+    }
+    // Propagates the borrows. The top limb is negative iff |a| < |b|.
+    for (size_t i = 0; i < kLimbNums - 1; ++i) {
+      t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srai_epi64(t[i], 52));
+      t[i] = _mm512_and_si512(t[i], mask);
+    }
+    __mmask8 negative =
+        _mm512_cmplt_epi64_mask(t[kLimbNums - 1], _mm512_setzero_si512());
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      t[i] = _mm512_mask_add_epi64(t[i], negative, t[i],
+                                   _mm512_set1_epi64(kModulus[i]));
+    }
+    Normalize(t);
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      r->limbs[i] = t[i];
+    }
+  }
+
+  ALWAYS_INLINE static void Mul(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m512i t[2 * kLimbNums];
+    for (size_t i = 0; i < 2 * kLimbNums; ++i) {
+      t[i] = _mm512_setzero_si512();
+    }
+#pragma GCC unroll 5
+    for (size_t i = 0; i < kLimbNums; ++i) {
+#pragma GCC unroll 5
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        t[i + j] = _mm512_madd52lo_epu64(t[i + j], a.limbs[i], b.limbs[j]);
+        t[i + j + 1] =
+            _mm512_madd52hi_epu64(t[i + j + 1], a.limbs[i], b.limbs[j]);
+      }
+    }
+    MontgomeryReduce(t, r);
+  }
+
+  ALWAYS_INLINE static void Square(const Storage& a, Storage* r) {
+    __m512i t[2 * kLimbNums];
+    for (size_t i = 0; i < 2 * kLimbNums; ++i) {
+      t[i] = _mm512_setzero_si512();
+    }
+    // Adds the cross products once and doubles them, and then adds the
+    // squares of the limbs.
+#pragma GCC unroll 5
+    for (size_t i = 0; i < kLimbNums; ++i) {
+#pragma GCC unroll 5
+      for (size_t j = i + 1; j < kLimbNums; ++j) {
+        t[i + j] = _mm512_madd52lo_epu64(t[i + j], a.limbs[i], a.limbs[j]);
+        t[i + j + 1] =
+            _mm512_madd52hi_epu64(t[i + j + 1], a.limbs[i], a.limbs[j]);
+      }
+    }
+    for (size_t i = 0; i < 2 * kLimbNums; ++i) {
+      t[i] = _mm512_slli_epi64(t[i], 1);
+    }
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      t[2 * i] = _mm512_madd52lo_epu64(t[2 * i], a.limbs[i], a.limbs[i]);
+      t[2 * i + 1] =
+          _mm512_madd52hi_epu64(t[2 * i + 1], a.limbs[i], a.limbs[i]);
+    }
+    MontgomeryReduce(t, r);
+  }
+
+ private:
+  constexpr static uint64_t kMask48 = (uint64_t{1} << 48) - 1;
+  constexpr static std::array<uint64_t, kLimbNums> kModulus =
+      ToLimbs52(Config::kModulus);
+  // -|Config::kModulus|⁻¹ mod 2⁵², which is also the inverse mod 2⁴⁸.
+  constexpr static uint64_t kInverse52 = Config::kInverse64 & kMask52;
+
+  // Transposes |v|, where v[i] holds the (2i)-th and (2i + 1)-th elements,
+  // into |w|, where w[i] holds the i-th 64-bit limbs of the 8 elements.
+  ALWAYS_INLINE static void TransposeToLimbs(const __m512i v[4],
+                                             __m512i w[4]) {
+    __m512i lo = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    __m512i hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    __m512i t0 = _mm512_permutex2var_epi64(v[0], lo, v[1]);
+    __m512i t1 = _mm512_permutex2var_epi64(v[0], hi, v[1]);
+    __m512i t2 = _mm512_permutex2var_epi64(v[2], lo, v[3]);
+    __m512i t3 = _mm512_permutex2var_epi64(v[2], hi, v[3]);
+    lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    w[0] = _mm512_permutex2var_epi64(t0, lo, t2);
+    w[1] = _mm512_permutex2var_epi64(t0, hi, t2);
+    w[2] = _mm512_permutex2var_epi64(t1, lo, t3);
+    w[3] = _mm512_permutex2var_epi64(t1, hi, t3);
+  }
+
+  // The inverse of |TransposeToLimbs()|.
+  ALWAYS_INLINE static void TransposeToElements(const __m512i w[4],
+                                                __m512i v[4]) {
+    __m512i lo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    __m512i hi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    __m512i t0 = _mm512_permutex2var_epi64(w[0], lo, w[1]);
+    __m512i t2 = _mm512_permutex2var_epi64(w[0], hi, w[1]);
+    __m512i t1 = _mm512_permutex2var_epi64(w[2], lo, w[3]);
+    __m512i t3 = _mm512_permutex2var_epi64(w[2], hi, w[3]);
+    lo = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    hi = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    v[0] = _mm512_permutex2var_epi64(t0, lo, t1);
+    v[1] = _mm512_permutex2var_epi64(t0, hi, t1);
+    v[2] = _mm512_permutex2var_epi64(t2, lo, t3);
+    v[3] = _mm512_permutex2var_epi64(t2, hi, t3);
+  }
+
+  // Carries the bits above 52 of each limb over to the next one.
+  ALWAYS_INLINE static void Normalize(__m512i t[kLimbNums]) {
+    __m512i mask = _mm512_set1_epi64(kMask52);
+    for (size_t i = 0; i < kLimbNums - 1; ++i) {
+      t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+      t[i] = _mm512_and_si512(t[i], mask);
+    }
+  }
+
+  // Subtracts the modulus from |t| in [0, 2 * modulus), where |t| is
+  // normalized.
+  ALWAYS_INLINE static void ReduceOnce(const __m512i t[kLimbNums],
+                                       Storage* r) {
+    __m512i mask = _mm512_set1_epi64(kMask52);
+    __m512i d[kLimbNums];
+    __m512i borrow = _mm512_setzero_si512();
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      d[i] = _mm512_sub_epi64(
+          _mm512_sub_epi64(t[i], _mm512_set1_epi64(kModulus[i])), borrow);
+      borrow = _mm512_srli_epi64(d[i], 63);
+      if (i != kLimbNums - 1) d[i] = _mm512_and_si512(d[i], mask);
+    }
+    __mmask8 negative =
+        _mm512_cmplt_epi64_mask(d[kLimbNums - 1], _mm512_setzero_si512());
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      r->limbs[i] = _mm512_mask_blend_epi64(negative, d[i], t[i]);
+    }
+  }
+
+  // Computes |t| * 2⁻²⁵⁶ mod modulus, where |t| is a product of 2 reduced
+  // elements. Each limb of |t| can hold more than 52 bits as the partial
+  // products are added without carrying.
+  ALWAYS_INLINE static void MontgomeryReduce(__m512i t[2 * kLimbNums],
+                                             Storage* r) {
+    __m512i zero = _mm512_setzero_si512();
+    __m512i inverse = _mm512_set1_epi64(kInverse52);
+#pragma GCC unroll 5
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      __m512i m = _mm512_madd52lo_epu64(zero, t[i], inverse);
+      if (i == kLimbNums - 1) {
+        m = _mm512_and_si512(m, _mm512_set1_epi64(kMask48));
+      }
+#pragma GCC unroll 5
+      for (size_t j = 0; j < kLimbNums; ++j) {
+        __m512i modulus = _mm512_set1_epi64(kModulus[j]);
+        t[i + j] = _mm512_madd52lo_epu64(t[i + j], m, modulus);
+        t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], m, modulus);
+      }
+      if (i != kLimbNums - 1) {
+        t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+      }
+    }
+    // The low 48 bits of t[4] are zero now. Normalizes t[4..9] and shifts it
+    // right by 48 bits.
+    __m512i mask = _mm512_set1_epi64(kMask52);
+    for (size_t i = kLimbNums - 1; i < 2 * kLimbNums - 1; ++i) {
+      t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+      t[i] = _mm512_and_si512(t[i], mask);
+    }
+    __m512i u[kLimbNums];
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      u[i] = _mm512_or_si512(
+          _mm512_srli_epi64(t[kLimbNums - 1 + i], 48),
+          _mm512_and_si512(_mm512_slli_epi64(t[kLimbNums + i], 4), mask));
+    }
+    ReduceOnce(u, r);
+  }
+};
+
+}  // namespace tachyon::math::internal
+
+#if defined(COMPILER_GCC) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // defined(TACHYON_HAS_AVX512_IFMA)
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_AVX512_IFMA_H_
@@ -0,0 +1,82 @@
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
+
+namespace tachyon::math {
+namespace {
+
+template <typename F>
+std::vector<F> PrepareTestSet(size_t size) {
+  std::vector<F> test_set;
+  test_set.reserve(size);
+  for (size_t i = 0; i < size; ++i) {
+    test_set.push_back(F::Random());
+  }
+  return test_set;
+}
+
+}  // namespace
+
+template <typename F>
+void BM_Mul(benchmark::State& state) {
+  size_t size = state.range(0);
+  std::vector<F> as = PrepareTestSet<F>(size);
+  std::vector<F> bs = PrepareTestSet<F>(size);
+  for (auto _ : state) {
+    for (size_t i = 0; i < size; ++i) {
+      as[i] *= bs[i];
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+template <typename F, size_t Lanes>
+void BM_PackedMul(benchmark::State& state) {
+  using Packed = PackedPrimeField<F, Lanes>;
+
+  size_t size = state.range(0);
+  std::vector<F> as = PrepareTestSet<F>(size);
+  std::vector<F> bs = PrepareTestSet<F>(size);
+  for (auto _ : state) {
+    for (size_t i = 0; i < size; i += Lanes) {
+      (Packed::Load(&as[i]) * Packed::Load(&bs[i])).Store(&as[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetLabel(Packed::kIsVectorized ? "vectorized" : "scalar");
+}
+
+template <typename F, size_t Lanes>
+void BM_PackedSquare(benchmark::State& state) {
+  using Packed = PackedPrimeField<F, Lanes>;
+
+  size_t size = state.range(0);
+  std::vector<F> as = PrepareTestSet<F>(size);
+  for (auto _ : state) {
+    for (size_t i = 0; i < size; i += Lanes) {
+      Packed::Load(&as[i]).Square().Store(&as[i]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetLabel(Packed::kIsVectorized ? "vectorized" : "scalar");
+}
+
+BENCHMARK_TEMPLATE(BM_Mul, bn254::Fq)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedMul, bn254::Fq, 4)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedMul, bn254::Fq, 8)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedSquare, bn254::Fq, 4)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedSquare, bn254::Fq, 8)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_Mul, Goldilocks)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedMul, Goldilocks, 4)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedMul, Goldilocks, 8)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedSquare, Goldilocks, 4)->Arg(1 << 10);
+BENCHMARK_TEMPLATE(BM_PackedSquare, Goldilocks, 8)->Arg(1 << 10);
+
+}  // namespace tachyon::math
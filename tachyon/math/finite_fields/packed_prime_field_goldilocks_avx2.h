@@ -0,0 +1,154 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_GOLDILOCKS_AVX2_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_GOLDILOCKS_AVX2_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/packed_prime_field_avx2.h"
+#include "tachyon/math/finite_fields/prime_field.h"
+
+namespace tachyon::math::internal {
+
+// The Goldilocks prime, 2⁶⁴ - 2³² + 1.
+constexpr uint64_t kGoldilocksModulus = UINT64_C(0xffffffff00000001);
+// 2⁶⁴ mod the Goldilocks prime, which is 2³² - 1.
+constexpr uint64_t kGoldilocksEpsilon = UINT64_C(0xffffffff);
+
+}  // namespace tachyon::math::internal
+
+#if defined(TACHYON_HAS_AVX2)
+
+#include <immintrin.h>
+
+namespace tachyon::math::internal {
+
+// Montgomery arithmetic over 4 elements of the Goldilocks |PrimeField| at
+// once, an element per 64-bit lane. Elements are kept reduced and in the same
+// Montgomery form as |PrimeField|, where R is 2⁶⁴. Since 2⁶⁴ ≡ 2³² - 1, a
+// carry out of 64 bits is folded back by adding 2³² - 1, and the Montgomery
+// reduction takes shifts and subtractions instead of multiplications. AVX2
+// has neither unsigned 64-bit comparisons nor 64 x 64-bit multiplications, so
+// they are emulated with signed comparisons and VPMULUDQ.
+template <typename Config>
+class PackedPrimeFieldGoldilocksAvx2 {
+ public:
+  using F = PrimeField<Config>;
+
+  static_assert(Config::kModulus[0] == kGoldilocksModulus);
+  static_assert(sizeof(F) == sizeof(uint64_t));
+
+  constexpr static size_t kLanes = 4;
+  constexpr static bool kIsVectorized = true;
+
+  struct Storage {
+    __m256i value;
+  };
+
+  ALWAYS_INLINE static void Load(const F* src, Storage* r) {
+    r->value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+  }
+
+  ALWAYS_INLINE static void Store(const Storage& a, F* dst) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), a.value);
+  }
+
+  ALWAYS_INLINE static void Broadcast(const F& value, Storage* r) {
+    r->value = _mm256_set1_epi64x(value.value()[0]);
+  }
+
+  ALWAYS_INLINE static void Add(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m256i epsilon = _mm256_set1_epi64x(kGoldilocksEpsilon);
+    __m256i sum = _mm256_add_epi64(a.value, b.value);
+    // If the sum overflows, the result is less than the modulus after adding
+    // 2³² - 1 back.
+    sum = _mm256_add_epi64(sum,
+                           _mm256_and_si256(LessThan(sum, a.value), epsilon));
+    // Subtracts the modulus, that is, adds 2³² - 1, if |sum| is not less than
+    // the modulus, which is when adding 2³² - 1 overflows.
+    __m256i reduced = _mm256_add_epi64(sum, epsilon);
+    r->value = _mm256_blendv_epi8(sum, reduced, LessThan(reduced, sum));
+  }
+
+  ALWAYS_INLINE static void Sub(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m256i diff = _mm256_sub_epi64(a.value, b.value);
+    // If |a| < |b|, adds the modulus back, that is, subtracts 2³² - 1.
+    r->value = _mm256_sub_epi64(
+        diff, _mm256_and_si256(LessThan(a.value, b.value),
+                               _mm256_set1_epi64x(kGoldilocksEpsilon)));
+  }
+
+  ALWAYS_INLINE static void Mul(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m256i a_hi = _mm256_srli_epi64(a.value, 32);
+    __m256i b_hi = _mm256_srli_epi64(b.value, 32);
+    __m256i lo_lo = _mm256_mul_epu32(a.value, b.value);
+    __m256i lo_hi = _mm256_mul_epu32(a.value, b_hi);
+    __m256i hi_lo = _mm256_mul_epu32(a_hi, b.value);
+    __m256i hi_hi = _mm256_mul_epu32(a_hi, b_hi);
+    __m256i lo, hi;
+    Combine(lo_lo, lo_hi, hi_lo, hi_hi, &lo, &hi);
+    r->value = MontgomeryReduce(lo, hi);
+  }
+
+  ALWAYS_INLINE static void Square(const Storage& a, Storage* r) {
+    __m256i a_hi = _mm256_srli_epi64(a.value, 32);
+    __m256i lo_lo = _mm256_mul_epu32(a.value, a.value);
+    __m256i lo_hi = _mm256_mul_epu32(a.value, a_hi);
+    __m256i hi_hi = _mm256_mul_epu32(a_hi, a_hi);
+    __m256i lo, hi;
+    Combine(lo_lo, lo_hi, lo_hi, hi_hi, &lo, &hi);
+    r->value = MontgomeryReduce(lo, hi);
+  }
+
+ private:
+  // Returns all ones in the lanes where |a| < |b| as unsigned integers. AVX2
+  // only has a signed comparison, so both sides are shifted by 2⁶³ first.
+  ALWAYS_INLINE static __m256i LessThan(__m256i a, __m256i b) {
+    __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+    return _mm256_cmpgt_epi64(_mm256_xor_si256(b, sign),
+                              _mm256_xor_si256(a, sign));
+  }
+
+  // Adds up the 4 partial products of 32 x 32 bits into a product of 128
+  // bits, which is |lo| + |hi| * 2⁶⁴. None of the sums below overflows.
+  ALWAYS_INLINE static void Combine(__m256i lo_lo, __m256i lo_hi,
+                                    __m256i hi_lo, __m256i hi_hi, __m256i* lo,
+                                    __m256i* hi) {
+    __m256i mask = _mm256_set1_epi64x(kMask32);
+    __m256i t = _mm256_add_epi64(hi_lo, _mm256_srli_epi64(lo_lo, 32));
+    __m256i u = _mm256_add_epi64(lo_hi, _mm256_and_si256(t, mask));
+    *lo = _mm256_or_si256(_mm256_slli_epi64(u, 32),
+                          _mm256_and_si256(lo_lo, mask));
+    *hi = _mm256_add_epi64(
+        _mm256_add_epi64(hi_hi, _mm256_srli_epi64(t, 32)),
+        _mm256_srli_epi64(u, 32));
+  }
+
+  // Computes (|lo| + |hi| * 2⁶⁴) * 2⁻⁶⁴ mod modulus, where |hi| is less than
+  // the modulus. Since -modulus⁻¹ mod 2⁶⁴ is -(2³² + 1), the multiple of the
+  // modulus to add is derived from |lo| + |lo| * 2³², and the division by 2⁶⁴
+  // leaves |hi| minus the value below. See
+  // https://github.com/facebook/winterfell/blob/main/math/src/field/f64/mod.rs
+  ALWAYS_INLINE static __m256i MontgomeryReduce(__m256i lo, __m256i hi) {
+    __m256i a = _mm256_add_epi64(lo, _mm256_slli_epi64(lo, 32));
+    // A carry subtracts 1, and the all ones of |LessThan()| are -1.
+    __m256i b = _mm256_add_epi64(_mm256_sub_epi64(a, _mm256_srli_epi64(a, 32)),
+                                 LessThan(a, lo));
+    __m256i r = _mm256_sub_epi64(hi, b);
+    // If |hi| < |b|, adds the modulus back, that is, subtracts 2³² - 1, which
+    // is the all ones shifted right by 32.
+    return _mm256_sub_epi64(r, _mm256_srli_epi64(LessThan(hi, b), 32));
+  }
+
+  constexpr static uint64_t kMask32 = (uint64_t{1} << 32) - 1;
+};
+
+}  // namespace tachyon::math::internal
+
+#endif  // defined(TACHYON_HAS_AVX2)
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_GOLDILOCKS_AVX2_H_
@@ -0,0 +1,144 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_GOLDILOCKS_AVX512_H_
+#define TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_GOLDILOCKS_AVX512_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/packed_prime_field_goldilocks_avx2.h"
+#include "tachyon/math/finite_fields/prime_field.h"
+
+// AVX-512 is enabled by -mavx512f or -march of a CPU which has it. See
+// avx512_linux in .bazelrc.
+#if ARCH_CPU_X86_64 && defined(__AVX512F__)
+#define TACHYON_HAS_AVX512 1
+#endif
+
+#if defined(TACHYON_HAS_AVX512)
+
+#include <immintrin.h>
+
+// The AVX-512 intrinsics trip GCC 12's uninitialized warnings. See
+// packed_prime_field_avx512_ifma.h.
+#if defined(COMPILER_GCC) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+namespace tachyon::math::internal {
+
+// Montgomery arithmetic over 8 elements of the Goldilocks |PrimeField| at
+// once. This is the same as |PackedPrimeFieldGoldilocksAvx2|, except that
+// AVX-512 has unsigned 64-bit comparisons and masked additions, which take
+// the place of the emulated comparisons and the blends.
+template <typename Config>
+class PackedPrimeFieldGoldilocksAvx512 {
+ public:
+  using F = PrimeField<Config>;
+
+  static_assert(Config::kModulus[0] == kGoldilocksModulus);
+  static_assert(sizeof(F) == sizeof(uint64_t));
+
+  constexpr static size_t kLanes = 8;
+  constexpr static bool kIsVectorized = true;
+
+  struct Storage {
+    __m512i value;
+  };
+
+  ALWAYS_INLINE static void Load(const F* src, Storage* r) {
+    r->value = _mm512_loadu_si512(src);
+  }
+
+  ALWAYS_INLINE static void Store(const Storage& a, F* dst) {
+    _mm512_storeu_si512(dst, a.value);
+  }
+
+  ALWAYS_INLINE static void Broadcast(const F& value, Storage* r) {
+    r->value = _mm512_set1_epi64(value.value()[0]);
+  }
+
+  ALWAYS_INLINE static void Add(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m512i epsilon = _mm512_set1_epi64(kGoldilocksEpsilon);
+    __m512i sum = _mm512_add_epi64(a.value, b.value);
+    sum = _mm512_mask_add_epi64(sum, _mm512_cmplt_epu64_mask(sum, a.value),
+                                sum, epsilon);
+    r->value = _mm512_mask_add_epi64(
+        sum,
+        _mm512_cmpge_epu64_mask(sum, _mm512_set1_epi64(kGoldilocksModulus)),
+        sum, epsilon);
+  }
+
+  ALWAYS_INLINE static void Sub(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m512i diff = _mm512_sub_epi64(a.value, b.value);
+    r->value = _mm512_mask_sub_epi64(
+        diff, _mm512_cmplt_epu64_mask(a.value, b.value), diff,
+        _mm512_set1_epi64(kGoldilocksEpsilon));
+  }
+
+  ALWAYS_INLINE static void Mul(const Storage& a, const Storage& b,
+                                Storage* r) {
+    __m512i a_hi = _mm512_srli_epi64(a.value, 32);
+    __m512i b_hi = _mm512_srli_epi64(b.value, 32);
+    __m512i lo_lo = _mm512_mul_epu32(a.value, b.value);
+    __m512i lo_hi = _mm512_mul_epu32(a.value, b_hi);
+    __m512i hi_lo = _mm512_mul_epu32(a_hi, b.value);
+    __m512i hi_hi = _mm512_mul_epu32(a_hi, b_hi);
+    __m512i lo, hi;
+    Combine(lo_lo, lo_hi, hi_lo, hi_hi, &lo, &hi);
+    r->value = MontgomeryReduce(lo, hi);
+  }
+
+  ALWAYS_INLINE static void Square(const Storage& a, Storage* r) {
+    __m512i a_hi = _mm512_srli_epi64(a.value, 32);
+    __m512i lo_lo = _mm512_mul_epu32(a.value, a.value);
+    __m512i lo_hi = _mm512_mul_epu32(a.value, a_hi);
+    __m512i hi_hi = _mm512_mul_epu32(a_hi, a_hi);
+    __m512i lo, hi;
+    Combine(lo_lo, lo_hi, lo_hi, hi_hi, &lo, &hi);
+    r->value = MontgomeryReduce(lo, hi);
+  }
+
+ private:
+  // See |PackedPrimeFieldGoldilocksAvx2::Combine()|.
+  ALWAYS_INLINE static void Combine(__m512i lo_lo, __m512i lo_hi,
+                                    __m512i hi_lo, __m512i hi_hi, __m512i* lo,
+                                    __m512i* hi) {
+    __m512i mask = _mm512_set1_epi64(kMask32);
+    __m512i t = _mm512_add_epi64(hi_lo, _mm512_srli_epi64(lo_lo, 32));
+    __m512i u = _mm512_add_epi64(lo_hi, _mm512_and_si512(t, mask));
+    *lo = _mm512_or_si512(_mm512_slli_epi64(u, 32),
+                          _mm512_and_si512(lo_lo, mask));
+    *hi = _mm512_add_epi64(
+        _mm512_add_epi64(hi_hi, _mm512_srli_epi64(t, 32)),
+        _mm512_srli_epi64(u, 32));
+  }
+
+  // See |PackedPrimeFieldGoldilocksAvx2::MontgomeryReduce()|.
+  ALWAYS_INLINE static __m512i MontgomeryReduce(__m512i lo, __m512i hi) {
+    __m512i a = _mm512_add_epi64(lo, _mm512_slli_epi64(lo, 32));
+    __m512i b = _mm512_sub_epi64(a, _mm512_srli_epi64(a, 32));
+    b = _mm512_mask_sub_epi64(b, _mm512_cmplt_epu64_mask(a, lo), b,
+                              _mm512_set1_epi64(1));
+    __m512i r = _mm512_sub_epi64(hi, b);
+    return _mm512_mask_sub_epi64(r, _mm512_cmplt_epu64_mask(hi, b), r,
+                                 _mm512_set1_epi64(kGoldilocksEpsilon));
+  }
+
+  constexpr static uint64_t kMask32 = (uint64_t{1} << 32) - 1;
+};
+
+}  // namespace tachyon::math::internal
+
+#if defined(COMPILER_GCC) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // defined(TACHYON_HAS_AVX512)
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PACKED_PRIME_FIELD_GOLDILOCKS_AVX512_H_
@@ -0,0 +1,181 @@
+#include "tachyon/math/finite_fields/packed_prime_field.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/fq.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::math {
+
+namespace {
+
+constexpr size_t kChunks = 16;
+
+template <typename PackedPrimeFieldType>
+class PackedPrimeFieldTest : public testing::Test {
+ public:
+  using Packed = PackedPrimeFieldType;
+  using F = typename Packed::F;
+
+  void SetUp() override {
+    // The edge cases come first and the rest are random.
+    std::vector<F> edges = {F::Zero(), F::One(), -F::One(), F::One().Double()};
+    for (size_t i = 0; i < Packed::kLanes * kChunks; ++i) {
+      as_.push_back(i < edges.size() ? edges[i] : F::Random());
+      bs_.push_back(i < edges.size() ? edges[edges.size() - 1 - i]
+                                     : F::Random());
+    }
+    // Makes both of the operands of some lanes equal.
+    bs_[edges.size()] = as_[edges.size()];
+  }
+
+  template <typename PackedOp, typename Op>
+  void RunBinaryOp(PackedOp packed_op, Op op) {
+    for (size_t i = 0; i < as_.size(); i += Packed::kLanes) {
+      Packed a = Packed::Load(&as_[i]);
+      Packed b = Packed::Load(&bs_[i]);
+      std::array<F, Packed::kLanes> results = packed_op(a, b).ToArray();
+      for (size_t j = 0; j < Packed::kLanes; ++j) {
+        EXPECT_EQ(results[j], op(as_[i + j], bs_[i + j]));
+      }
+    }
+  }
+
+ protected:
+  std::vector<F> as_;
+  std::vector<F> bs_;
+};
+
+}  // namespace
+
+using PackedPrimeFieldTypes =
+    testing::Types<PackedPrimeField<bn254::Fr, 4>,
+                   PackedPrimeField<bn254::Fr, 8>,
+                   PackedPrimeField<bn254::Fq, 4>,
+                   PackedPrimeField<bn254::Fq, 8>,
+                   PackedPrimeField<secp256k1::Fq, 4>,
+                   PackedPrimeField<secp256k1::Fq, 8>,
+                   PackedPrimeField<Goldilocks, 4>,
+                   PackedPrimeField<Goldilocks, 8>, PackedPrimeField<GF7, 4>>;
+TYPED_TEST_SUITE(PackedPrimeFieldTest, PackedPrimeFieldTypes);
+
+TYPED_TEST(PackedPrimeFieldTest, LoadAndStore) {
+  using Packed = typename TestFixture::Packed;
+  using F = typename TestFixture::F;
+
+  std::vector<F> stored(this->as_.size());
+  for (size_t i = 0; i < this->as_.size(); i += Packed::kLanes) {
+    Packed::Load(&this->as_[i]).Store(&stored[i]);
+  }
+  EXPECT_EQ(stored, this->as_);
+}
+
+TYPED_TEST(PackedPrimeFieldTest, Broadcast) {
+  using Packed = typename TestFixture::Packed;
+  using F = typename TestFixture::F;
+
+  for (const F& a : {F::Zero(), F::One(), F::Random()}) {
+    std::array<F, Packed::kLanes> expected;
+    expected.fill(a);
+    EXPECT_EQ(Packed::Broadcast(a).ToArray(), expected);
+  }
+  EXPECT_EQ(Packed::Zero(), Packed::Broadcast(F::Zero()));
+  EXPECT_EQ(Packed::One(), Packed::Broadcast(F::One()));
+}
+
+TYPED_TEST(PackedPrimeFieldTest, Add) {
+  using Packed = typename TestFixture::Packed;
+  using F = typename TestFixture::F;
+
+  this->RunBinaryOp([](const Packed& a, const Packed& b) { return a + b; },
+                    [](const F& a, const F& b) { return a + b; });
+  this->RunBinaryOp(
+      [](Packed a, const Packed& b) {
+        a += b;
+        return a;
+      },
+      [](const F& a, const F& b) { return a + b; });
+}
+
+TYPED_TEST(PackedPrimeFieldTest, Sub) {
+  using Packed = typename TestFixture::Packed;
+  using F = typename TestFixture::F;
+
+  this->RunBinaryOp([](const Packed& a, const Packed& b) { return a - b; },
+                    [](const F& a, const F& b) { return a - b; });
+  this->RunBinaryOp(
+      [](Packed a, const Packed& b) {
+        a -= b;
+        return a;
+      },
+      [](const F& a, const F& b) { return a - b; });
+}
+
+TYPED_TEST(PackedPrimeFieldTest, Mul) {
+  using Packed = typename TestFixture::Packed;
+  using F = typename TestFixture::F;
+
+  this->RunBinaryOp([](const Packed& a, const Packed& b) { return a * b; },
+                    [](const F& a, const F& b) { return a * b; });
+  this->RunBinaryOp(
+      [](Packed a, const Packed& b) {
+        a *= b;
+        return a;
+      },
+      [](const F& a, const F& b) { return a * b; });
+}
+
+TYPED_TEST(PackedPrimeFieldTest, Square) {
+  using Packed = typename TestFixture::Packed;
+  using F = typename TestFixture::F;
+
+  this->RunBinaryOp([](const Packed& a, const Packed& b) { return a.Square(); },
+                    [](const F& a, const F& b) { return a.Square(); });
+  this->RunBinaryOp(
+      [](Packed a, const Packed& b) {
+        a.SquareInPlace();
+        return a;
+      },
+      [](const F& a, const F& b) { return a.Square(); });
+}
+
+TYPED_TEST(PackedPrimeFieldTest, Pow) {
+  using Packed = typename TestFixture::Packed;
+  using F = typename TestFixture::F;
+
+  for (uint64_t exponent : {0, 1, 5, 7, 1234567}) {
+    BigInt<1> e(exponent);
+    this->RunBinaryOp(
+        [&e](const Packed& a, const Packed& b) { return a.Pow(e); },
+        [&e](const F& a, const F& b) { return a.Pow(e); });
+  }
+}
+
+TEST(PackedPrimeFieldVectorizedTest, IsVectorized) {
+#if !defined(TACHYON_POLYGON_ZKEVM_BACKEND)
+#if defined(TACHYON_HAS_AVX512_IFMA)
+  EXPECT_TRUE((PackedPrimeField<bn254::Fq, 8>::kIsVectorized));
+  EXPECT_TRUE((PackedPrimeField<secp256k1::Fq, 8>::kIsVectorized));
+#endif  // defined(TACHYON_HAS_AVX512_IFMA)
+#if defined(TACHYON_HAS_AVX2) && !defined(TACHYON_HAS_MULX_ADX)
+  EXPECT_TRUE((PackedPrimeField<bn254::Fq, 4>::kIsVectorized));
+#endif  // defined(TACHYON_HAS_AVX2) && !defined(TACHYON_HAS_MULX_ADX)
+#if defined(TACHYON_HAS_AVX512)
+  EXPECT_TRUE((PackedPrimeField<Goldilocks, 8>::kIsVectorized));
+  EXPECT_EQ(PackedPrimeField<Goldilocks>::kLanes, 8);
+#endif  // defined(TACHYON_HAS_AVX512)
+#if defined(TACHYON_HAS_AVX2)
+  EXPECT_TRUE((PackedPrimeField<Goldilocks, 4>::kIsVectorized));
+#endif  // defined(TACHYON_HAS_AVX2)
+#endif  // !defined(TACHYON_POLYGON_ZKEVM_BACKEND)
+  // secp256k1 Fq has no spare bit, which the AVX2 one needs.
+  EXPECT_FALSE((PackedPrimeField<secp256k1::Fq, 4>::kIsVectorized));
+  EXPECT_FALSE((PackedPrimeField<GF7, 4>::kIsVectorized));
+}
+
+}  // namespace tachyon::math
@@ -9,15 +9,22 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <iterator>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "gtest/gtest_prod.h"
 
+#include "tachyon/base/template_util.h"
 #include "tachyon/math/base/arithmetics.h"
 #include "tachyon/math/base/big_int.h"
 #include "tachyon/math/base/gmp/gmp_util.h"
 #include "tachyon/math/finite_fields/modulus.h"
+#include "tachyon/math/finite_fields/prime_field_accumulator.h"
 #include "tachyon/math/finite_fields/prime_field_base.h"
+#include "tachyon/math/finite_fields/prime_field_mulx_adx.h"
+#include "tachyon/math/finite_fields/safegcd.h"
 
 namespace tachyon::math {
 
@@ -190,6 +197,11 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   // TODO(chokobole): Support bigendian.
   // MultiplicativeSemigroup methods
   constexpr PrimeField& MulInPlace(const PrimeField& other) {
+#if defined(TACHYON_HAS_MULX_ADX)
+    if constexpr (N == 4) {
+      return MulxAdxMulInPlace(other);
+    }
+#endif  // defined(TACHYON_HAS_MULX_ADX)
     if constexpr (Config::kCanUseNoCarryMulOptimization) {
       return FastMulInPlace(other);
     } else {
@@ -198,6 +210,11 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
   }
 
   constexpr PrimeField& SquareInPlace() {
+#if defined(TACHYON_HAS_MULX_ADX)
+    if constexpr (N == 4) {
+      return MulxAdxMulInPlace(*this);
+    }
+#endif  // defined(TACHYON_HAS_MULX_ADX)
     if (N == 1) {
       return MulInPlace(*this);
     }
@@ -239,12 +256,53 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
     return MulInPlace(other.Inverse());
   }
 
+  // If |Config::kUseSafeGcdInverse| is set, this runs in constant time. See
+  // safegcd.h.
   constexpr PrimeField& InverseInPlace() {
-    value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
-        Config::kModulus, Config::kMontgomeryR2);
+    if constexpr (Config::kUseSafeGcdInverse) {
+      value_ = SafeGcd<Config>::Inverse(value_, Config::kMontgomeryR2);
+    } else {
+      value_ = value_.template MontgomeryInverse<Config::kModulusHasSpareBit>(
+          Config::kModulus, Config::kMontgomeryR2);
+    }
     return *this;
   }
 
+  // Field methods
+  // Sum of products: a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ
+  // This hides |Field::SumOfProducts()| to add up the products before
+  // reducing them. See prime_field_accumulator.h.
+  template <typename InputIterator, typename InputIterator2,
+            std::enable_if_t<
+                std::is_same_v<PrimeField, base::iter_value_t<InputIterator>> &&
+                std::is_same_v<PrimeField,
+                               base::iter_value_t<InputIterator2>>>* = nullptr>
+  constexpr static PrimeField SumOfProducts(InputIterator a_first,
+                                            InputIterator a_last,
+                                            InputIterator2 b_first,
+                                            InputIterator2 b_last) {
+    if constexpr (PrimeFieldAccumulator<PrimeField>::kMaxTerms > 1) {
+      PrimeFieldAccumulator<PrimeField> accumulator;
+      while (a_first != a_last) {
+        accumulator.AddProduct(*a_first, *b_first);
+        ++a_first;
+        ++b_first;
+      }
+      return accumulator.Sum();
+    } else {
+      return Field<PrimeField>::SumOfProducts(
+          std::move(a_first), std::move(a_last), std::move(b_first),
+          std::move(b_last));
+    }
+  }
+
+  template <typename Container, typename Container2>
+  constexpr static PrimeField SumOfProducts(const Container& a,
+                                            const Container2& b) {
+    return SumOfProducts(std::begin(a), std::end(a), std::begin(b),
+                         std::end(b));
+  }
+
  private:
   template <typename PrimeFieldType>
   FRIEND_TEST(PrimeFieldCorrectnessTest, MultiplicativeOperators);
@@ -276,6 +334,18 @@ class PrimeField<_Config, std::enable_if_t<!_Config::kIsSpecialPrime>> final
     return *this;
   }
 
+#if defined(TACHYON_HAS_MULX_ADX)
+  // See prime_field_mulx_adx.h.
+  PrimeField& MulxAdxMulInPlace(const PrimeField& other) {
+    static_assert(N == 4);
+    bool carry = internal::mulx_adx::MontMul4(
+        value_, other.value_, Config::kModulus, Config::kInverse64, &value_);
+    BigInt<N>::template Clamp<Config::kModulusHasSpareBit>(Config::kModulus,
+                                                           &value_, carry);
+    return *this;
+  }
+#endif  // defined(TACHYON_HAS_MULX_ADX)
+
   constexpr PrimeField& SlowMulInPlace(const PrimeField& other) {
     BigInt<N * 2> r;
     MulResult<uint64_t> mul_result;
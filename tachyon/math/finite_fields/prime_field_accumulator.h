@@ -0,0 +1,110 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_ACCUMULATOR_H_
+#define TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_ACCUMULATOR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <limits>
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/arithmetics.h"
+#include "tachyon/math/base/big_int.h"
+#include "tachyon/math/finite_fields/prime_field_mulx_adx.h"
+
+namespace tachyon::math {
+
+// |PrimeFieldAccumulator| computes a₁ * b₁ + a₂ * b₂ + ... + aₙ * bₙ of a
+// |PrimeField| by adding up the products of 2N limbs as they are and reducing
+// them at once, instead of reducing every product.
+//
+// A Montgomery reduction of t returns a value less than 2 * modulus, which is
+// fixed by a single subtraction, as long as t < modulus * R. Since each
+// product is less than modulus², up to R / modulus products can be added
+// before the sum is reduced, which is what the spare bits of the modulus buy.
+// Once the sum is full, it is reduced into |reduced_| and starts over, so the
+// number of products is unbounded. Without a spare bit, R / modulus is 1 and
+// this is no faster than |Ring::SumOfProducts()|.
+template <typename F>
+class PrimeFieldAccumulator {
+ public:
+  using Config = typename F::Config;
+
+  constexpr static size_t N = F::N;
+  // The number of products that the sum can hold, which is
+  // 2⁶⁴ / (the top limb of the modulus + 1), a lower bound of R / modulus.
+  constexpr static size_t kMaxTerms =
+      Config::kModulus[N - 1] == std::numeric_limits<uint64_t>::max()
+          ? 1
+          : std::numeric_limits<uint64_t>::max() /
+                (Config::kModulus[N - 1] + 1);
+
+  constexpr PrimeFieldAccumulator() = default;
+
+  // Adds |a| * |b| to the sum.
+  constexpr void AddProduct(const F& a, const F& b) {
+    if (num_terms_ == kMaxTerms) {
+      reduced_ += Reduce(sum_);
+      sum_ = BigInt<2 * N>();
+      num_terms_ = 0;
+    }
+    BigInt<2 * N> product;
+#if defined(TACHYON_HAS_MULX_ADX)
+    if constexpr (N == 4) {
+      internal::mulx_adx::Mul4(a.value(), b.value(), &product);
+    } else {
+      Mul(a.value(), b.value(), &product);
+    }
+#else
+    Mul(a.value(), b.value(), &product);
+#endif
+    uint64_t carry = 0;
+    sum_.AddInPlace(product, carry);
+    DCHECK_EQ(carry, uint64_t{0});
+    ++num_terms_;
+  }
+
+  // Returns the sum of the products added so far.
+  constexpr F Sum() const { return reduced_ + Reduce(sum_); }
+
+ private:
+  // The schoolbook multiplication into 2N limbs.
+  constexpr static void Mul(const BigInt<N>& a, const BigInt<N>& b,
+                            BigInt<2 * N>* r) {
+    MulResult<uint64_t> mul_result;
+    for (size_t i = 0; i < N; ++i) {
+      for (size_t j = 0; j < N; ++j) {
+        mul_result = internal::u64::MulAddWithCarry((*r)[i + j], a[i], b[j],
+                                                    mul_result.hi);
+        (*r)[i + j] = mul_result.lo;
+      }
+      (*r)[i + N] = mul_result.hi;
+      mul_result.hi = 0;
+    }
+  }
+
+  constexpr static F Reduce(BigInt<2 * N> sum) {
+    BigInt<N> ret;
+#if defined(TACHYON_HAS_MULX_ADX)
+    if constexpr (N == 4) {
+      bool carry = internal::mulx_adx::MontReduce4(
+          sum, Config::kModulus, Config::kInverse64, &ret);
+      BigInt<N>::template Clamp<Config::kModulusHasSpareBit>(Config::kModulus,
+                                                             &ret, carry);
+      return F::FromMontgomery(ret);
+    }
+#endif
+    BigInt<N>::template MontgomeryReduce64<Config::kModulusHasSpareBit>(
+        sum, Config::kModulus, Config::kInverse64, &ret);
+    return F::FromMontgomery(ret);
+  }
+
+  // The sum of the products which are not reduced yet.
+  BigInt<2 * N> sum_;
+  size_t num_terms_ = 0;
+  // The sum of the products which are reduced already.
+  F reduced_ = F::Zero();
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_ACCUMULATOR_H_
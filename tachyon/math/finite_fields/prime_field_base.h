@@ -20,10 +20,10 @@ namespace tachyon {
 namespace math {
 
 struct TACHYON_EXPORT PrimeFieldFactors {
-  uint32_t q_adicity;
-  uint64_t q_part;
-  uint32_t two_adicity;
-  uint64_t two_part;
+  uint32_t q_adicity = 0;
+  uint64_t q_part = 0;
+  uint32_t two_adicity = 0;
+  uint64_t two_part = 0;
 };
 
 // PrimeField is a finite field GF(p) for p is prime.
@@ -2,6 +2,7 @@
 
 #include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
 #include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/safegcd.h"
 
 namespace tachyon::math {
 namespace {
@@ -43,6 +44,59 @@ ADD_BENCHMARK(Mul, *)
 
 #undef ADD_BENCHMARK
 
+template <typename PrimeFieldType>
+void BM_SumOfProducts(benchmark::State& state) {
+  PrimeFieldType::Init();
+  size_t size = state.range(0);
+  std::vector<PrimeFieldType> as = PrepareTestSet<PrimeFieldType>(size);
+  std::vector<PrimeFieldType> bs = PrepareTestSet<PrimeFieldType>(size);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(PrimeFieldType::SumOfProducts(as, bs));
+  }
+}
+
+// Reduces every product, which is what |PrimeField::SumOfProducts()| did
+// before it accumulated the products.
+template <typename PrimeFieldType>
+void BM_SumOfProductsReducingEach(benchmark::State& state) {
+  PrimeFieldType::Init();
+  size_t size = state.range(0);
+  std::vector<PrimeFieldType> as = PrepareTestSet<PrimeFieldType>(size);
+  std::vector<PrimeFieldType> bs = PrepareTestSet<PrimeFieldType>(size);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(Ring<PrimeFieldType>::SumOfProducts(as, bs));
+  }
+}
+
+template <typename PrimeFieldType>
+void BM_MontgomeryInverse(benchmark::State& state) {
+  using Config = typename PrimeFieldType::Config;
+  PrimeFieldType::Init();
+  size_t size = state.range(0);
+  std::vector<PrimeFieldType> test_set = PrepareTestSet<PrimeFieldType>(size);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        test_set[(i++) % size]
+            .value()
+            .template MontgomeryInverse<Config::kModulusHasSpareBit>(
+                Config::kModulus, Config::kMontgomeryR2));
+  }
+}
+
+template <typename PrimeFieldType>
+void BM_SafeGcdInverse(benchmark::State& state) {
+  using Config = typename PrimeFieldType::Config;
+  PrimeFieldType::Init();
+  size_t size = state.range(0);
+  std::vector<PrimeFieldType> test_set = PrepareTestSet<PrimeFieldType>(size);
+  size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SafeGcd<Config>::Inverse(
+        test_set[(i++) % size].value(), Config::kMontgomeryR2));
+  }
+}
+
 BENCHMARK_TEMPLATE(BM_Add, bn254::Fq)->Arg(1000);
 BENCHMARK_TEMPLATE(BM_Mul, bn254::Fq)->Arg(1000);
 #if defined(TACHYON_GMP_BACKEND)
@@ -50,8 +104,16 @@ BENCHMARK_TEMPLATE(BM_Add, bn254::FqGmp)->Arg(1000);
 BENCHMARK_TEMPLATE(BM_Mul, bn254::FqGmp)->Arg(1000);
 #endif  // defined(TACHYON_GMP_BACKEND)
 
+BENCHMARK_TEMPLATE(BM_SumOfProducts, bn254::Fq)->Arg(4)->Arg(16);
+BENCHMARK_TEMPLATE(BM_SumOfProductsReducingEach, bn254::Fq)->Arg(4)->Arg(16);
+
+BENCHMARK_TEMPLATE(BM_MontgomeryInverse, bn254::Fq)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_SafeGcdInverse, bn254::Fq)->Arg(1000);
+
 BENCHMARK_TEMPLATE(BM_Add, Goldilocks)->Arg(1000);
 BENCHMARK_TEMPLATE(BM_Mul, Goldilocks)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_MontgomeryInverse, Goldilocks)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_SafeGcdInverse, Goldilocks)->Arg(1000);
 #if defined(TACHYON_GMP_BACKEND)
 BENCHMARK_TEMPLATE(BM_Add, GoldilocksGmp)->Arg(1000);
 BENCHMARK_TEMPLATE(BM_Mul, GoldilocksGmp)->Arg(1000);
@@ -1,12 +1,10 @@
 #include "absl/strings/substitute.h"
 #include "gtest/gtest.h"
 
-#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
-#if defined(TACHYON_POLYGON_ZKEVM_BACKEND)
 #include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
 #include "tachyon/math/elliptic_curves/secp/secp256k1/fq.h"
 #include "tachyon/math/elliptic_curves/secp/secp256k1/fr.h"
-#endif
 #include "tachyon/math/finite_fields/prime_field_conversions.h"
 #include "tachyon/math/finite_fields/prime_field_gpu_debug.h"
 
@@ -78,12 +76,8 @@ std::vector<PrimeFieldType> PrimeFieldCorrectnessTest<PrimeFieldType>::bs_;
 
 }  // namespace
 
-#if defined(TACHYON_POLYGON_ZKEVM_BACKEND)
 using PrimeFieldTypes = testing::Types<bn254::Fr, bn254::Fq, secp256k1::Fq,
                                        secp256k1::Fr, FrGpuDebug>;
-#else
-using PrimeFieldTypes = testing::Types<bn254::Fr, FrGpuDebug>;
-#endif
 TYPED_TEST_SUITE(PrimeFieldCorrectnessTest, PrimeFieldTypes);
 
 TYPED_TEST(PrimeFieldCorrectnessTest, MontgomeryForm) {
@@ -160,12 +154,28 @@ TYPED_TEST(PrimeFieldCorrectnessTest, MultiplicativeOperators) {
     ASSERT_EQ(ConvertPrimeField<GmpF>(a * b), a_gmp * b_gmp);
     if constexpr (!F::Config::kIsSpecialPrime &&
                   !std::is_same_v<F, FrGpuDebug>) {
-      a.FastMulInPlace(b);
-      a_gmp *= b_gmp;
-      ASSERT_EQ(ConvertPrimeField<GmpF>(a), a_gmp);
+      if constexpr (F::Config::kCanUseNoCarryMulOptimization) {
+        a.FastMulInPlace(b);
+        a_gmp *= b_gmp;
+        ASSERT_EQ(ConvertPrimeField<GmpF>(a), a_gmp);
+      }
       a.SlowMulInPlace(b);
       a_gmp *= b_gmp;
       ASSERT_EQ(ConvertPrimeField<GmpF>(a), a_gmp);
+#if defined(TACHYON_HAS_MULX_ADX)
+      if constexpr (F::N == 4) {
+        F generic = a;
+        if constexpr (F::Config::kCanUseNoCarryMulOptimization) {
+          generic.FastMulInPlace(b);
+        } else {
+          generic.SlowMulInPlace(b);
+        }
+        a.MulxAdxMulInPlace(b);
+        ASSERT_EQ(a, generic);
+        a_gmp *= b_gmp;
+        ASSERT_EQ(ConvertPrimeField<GmpF>(a), a_gmp);
+      }
+#endif  // defined(TACHYON_HAS_MULX_ADX)
     } else {
       a *= b;
       a_gmp *= b_gmp;
@@ -210,6 +220,14 @@ TYPED_TEST(PrimeFieldCorrectnessTest, SumOfProducts) {
   const auto& b_gmps = PrimeFieldCorrectnessTest<F>::b_gmps_;
   ASSERT_EQ(ConvertPrimeField<GmpF>(F::SumOfProducts(as, bs)),
             GmpF::SumOfProducts(a_gmps, b_gmps));
+
+  // The largest products fill up the unreduced sum the fastest.
+  for (size_t n = 1; n <= 20; ++n) {
+    std::vector<F> max_values(n, -F::One());
+    std::vector<GmpF> max_value_gmps(n, -GmpF::One());
+    ASSERT_EQ(ConvertPrimeField<GmpF>(F::SumOfProducts(max_values, max_values)),
+              GmpF::SumOfProducts(max_value_gmps, max_value_gmps));
+  }
 }
 
 }  // namespace tachyon::math
@@ -0,0 +1,199 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MULX_ADX_H_
+#define TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MULX_ADX_H_
+
+#include <stdint.h>
+
+#include "tachyon/base/compiler_specific.h"
+#include "tachyon/build/build_config.h"
+#include "tachyon/math/base/big_int.h"
+
+// MULX and ADCX/ADOX come with BMI2 and ADX respectively, which are enabled by
+// -mbmi2 -madx or -march of a CPU which has them. See bmi2_adx_linux in
+// .bazelrc.
+#if ARCH_CPU_X86_64 && defined(__BMI2__) && defined(__ADX__) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define TACHYON_HAS_MULX_ADX 1
+#endif
+
+#if defined(TACHYON_HAS_MULX_ADX)
+
+namespace tachyon::math::internal::mulx_adx {
+
+// An iteration of the CIOS(Coarsely Integrated Operand Scanning) Montgomery
+// multiplication over 4 limbs. It adds a * b[i] and then m * modulus, which
+// makes T0 zero, to T0..T5. The low halves of the products are added on the
+// carry chain of ADOX and the high halves on the one of ADCX, so that both
+// run side by side. MULX doesn't touch the flags in between. Since T0 is zero
+// at the end, the next iteration takes T1..T5 as its T0..T4 and T0 as its T5.
+// RAX is kept zero to add the carries.
+#define TACHYON_MULX_ADX_MUL_ADD(SRC0, SRC1, SRC2, SRC3, T0, T1, T2, T3, T4, \
+                                 T5)                                         \
+  "xorl %%eax, %%eax\n\t"                                                    \
+  "mulxq " SRC0 ", %[lo], %[hi]\n\t"                                         \
+  "adoxq %[lo], %[" T0 "]\n\t"                                               \
+  "adcxq %[hi], %[" T1 "]\n\t"                                               \
+  "mulxq " SRC1 ", %[lo], %[hi]\n\t"                                         \
+  "adoxq %[lo], %[" T1 "]\n\t"                                               \
+  "adcxq %[hi], %[" T2 "]\n\t"                                               \
+  "mulxq " SRC2 ", %[lo], %[hi]\n\t"                                         \
+  "adoxq %[lo], %[" T2 "]\n\t"                                               \
+  "adcxq %[hi], %[" T3 "]\n\t"                                               \
+  "mulxq " SRC3 ", %[lo], %[hi]\n\t"                                         \
+  "adoxq %[lo], %[" T3 "]\n\t"                                               \
+  "adcxq %[hi], %[" T4 "]\n\t"                                               \
+  "adoxq %%rax, %[" T4 "]\n\t"                                               \
+  "adcxq %%rax, %[" T5 "]\n\t"                                               \
+  "adoxq %%rax, %[" T5 "]\n\t"
+
+#define TACHYON_MULX_ADX_ITERATION(I, T0, T1, T2, T3, T4, T5)                 \
+  "xorq %[" T5 "], %[" T5 "]\n\t"                                             \
+  "movq " #I "*8(%[b]), %%rdx\n\t" TACHYON_MULX_ADX_MUL_ADD(                  \
+      "0(%[a])", "8(%[a])", "16(%[a])", "24(%[a])", T0, T1, T2, T3, T4, T5)   \
+      "movq %[" T0 "], %%rdx\n\t"                                             \
+      "imulq %[inverse], %%rdx\n\t" TACHYON_MULX_ADX_MUL_ADD(                 \
+          "0(%[m])", "8(%[m])", "16(%[m])", "24(%[m])", T0, T1, T2, T3, T4, T5)
+
+// Computes |a| * |b| * R⁻¹ mod |modulus|, where R is 2²⁵⁶ and |inverse| is
+// -|modulus|⁻¹ mod 2⁶⁴. |r| can alias |a| or |b|. The result is in
+// [0, 2 * |modulus|) and its carry out of 256 bits is returned, so that it
+// can be clamped by |BigInt<4>::Clamp()|.
+//
+// Compilers lower _addcarryx_u64() into ADC on a single carry chain, so this
+// is written in assembly to run two chains with ADCX and ADOX.
+ALWAYS_INLINE bool MontMul4(const BigInt<4>& a, const BigInt<4>& b,
+                            const BigInt<4>& modulus, uint64_t inverse,
+                            BigInt<4>* r) {
+  uint64_t t0 = 0, t1 = 0, t2 = 0, t3 = 0, t4 = 0, t5 = 0;
+  uint64_t lo, hi;
+  // clang-format off
+  __asm__(
+      TACHYON_MULX_ADX_ITERATION(0, "t0", "t1", "t2", "t3", "t4", "t5")
+      TACHYON_MULX_ADX_ITERATION(1, "t1", "t2", "t3", "t4", "t5", "t0")
+      TACHYON_MULX_ADX_ITERATION(2, "t2", "t3", "t4", "t5", "t0", "t1")
+      TACHYON_MULX_ADX_ITERATION(3, "t3", "t4", "t5", "t0", "t1", "t2")
+      : [t0] "+&r"(t0), [t1] "+&r"(t1), [t2] "+&r"(t2), [t3] "+&r"(t3),
+        [t4] "+&r"(t4), [t5] "+&r"(t5), [lo] "=&r"(lo), [hi] "=&r"(hi)
+      : [a] "r"(a.limbs), [b] "r"(b.limbs), [m] "r"(modulus.limbs),
+        [inverse] "m"(inverse)
+      : "rax", "rdx", "cc", "memory");
+  // clang-format on
+  (*r)[0] = t4;
+  (*r)[1] = t5;
+  (*r)[2] = t0;
+  (*r)[3] = t1;
+  return t2 != 0;
+}
+
+// A row of the schoolbook multiplication over 4 limbs. It adds a * b[i] to
+// P0..P4, where P0..P3 hold the sum of the rows so far and P4 is fresh. The
+// high half of the last product goes to P4 directly, which then takes both
+// carries. They can't overflow it since the full product fits in 512 bits.
+#define TACHYON_MULX_ADX_ROW(I, P0, P1, P2, P3, P4) \
+  "xorl %%eax, %%eax\n\t"                           \
+  "movq " #I "*8(%[b]), %%rdx\n\t"                  \
+  "mulxq 0(%[a]), %[lo], %[hi]\n\t"                 \
+  "adoxq %[lo], %[" P0 "]\n\t"                      \
+  "adcxq %[hi], %[" P1 "]\n\t"                      \
+  "mulxq 8(%[a]), %[lo], %[hi]\n\t"                 \
+  "adoxq %[lo], %[" P1 "]\n\t"                      \
+  "adcxq %[hi], %[" P2 "]\n\t"                      \
+  "mulxq 16(%[a]), %[lo], %[hi]\n\t"                \
+  "adoxq %[lo], %[" P2 "]\n\t"                      \
+  "adcxq %[hi], %[" P3 "]\n\t"                      \
+  "mulxq 24(%[a]), %[lo], %[" P4 "]\n\t"            \
+  "adoxq %[lo], %[" P3 "]\n\t"                      \
+  "adoxq %%rax, %[" P4 "]\n\t"                      \
+  "adcxq %%rax, %[" P4 "]\n\t"
+
+// Computes the full 512-bit product of |a| and |b| without reducing it. This
+// is what |PrimeFieldAccumulator| adds up.
+ALWAYS_INLINE void Mul4(const BigInt<4>& a, const BigInt<4>& b,
+                        BigInt<8>* r) {
+  uint64_t p0 = 0, p1 = 0, p2 = 0, p3 = 0, p4, p5, p6, p7;
+  uint64_t lo, hi;
+  // clang-format off
+  __asm__(
+      TACHYON_MULX_ADX_ROW(0, "p0", "p1", "p2", "p3", "p4")
+      TACHYON_MULX_ADX_ROW(1, "p1", "p2", "p3", "p4", "p5")
+      TACHYON_MULX_ADX_ROW(2, "p2", "p3", "p4", "p5", "p6")
+      TACHYON_MULX_ADX_ROW(3, "p3", "p4", "p5", "p6", "p7")
+      : [p0] "+&r"(p0), [p1] "+&r"(p1), [p2] "+&r"(p2), [p3] "+&r"(p3),
+        [p4] "=&r"(p4), [p5] "=&r"(p5), [p6] "=&r"(p6), [p7] "=&r"(p7),
+        [lo] "=&r"(lo), [hi] "=&r"(hi)
+      : [a] "r"(a.limbs), [b] "r"(b.limbs)
+      : "rax", "rdx", "cc", "memory");
+  // clang-format on
+  (*r)[0] = p0;
+  (*r)[1] = p1;
+  (*r)[2] = p2;
+  (*r)[3] = p3;
+  (*r)[4] = p4;
+  (*r)[5] = p5;
+  (*r)[6] = p6;
+  (*r)[7] = p7;
+}
+
+// A row of the Montgomery reduction over 4 limbs. It adds m * modulus, which
+// makes T0 zero, to T0..T3 and the high half of the last product to T4
+// together with the carry of the previous row. The carry out of T4 is kept
+// in C as 0 or all ones for the next row. The high half can take both flags
+// since T0..T3 + m * modulus is less than 2³²⁰.
+#define TACHYON_MULX_ADX_REDUCE_ROW(T0, T1, T2, T3, T4) \
+  "movq %[" T0 "], %%rdx\n\t"                           \
+  "imulq %[inverse], %%rdx\n\t"                         \
+  "xorl %%eax, %%eax\n\t"                               \
+  "mulxq 0(%[m]), %[lo], %[hi]\n\t"                     \
+  "adoxq %[lo], %[" T0 "]\n\t"                          \
+  "adcxq %[hi], %[" T1 "]\n\t"                          \
+  "mulxq 8(%[m]), %[lo], %[hi]\n\t"                     \
+  "adoxq %[lo], %[" T1 "]\n\t"                          \
+  "adcxq %[hi], %[" T2 "]\n\t"                          \
+  "mulxq 16(%[m]), %[lo], %[hi]\n\t"                    \
+  "adoxq %[lo], %[" T2 "]\n\t"                          \
+  "adcxq %[hi], %[" T3 "]\n\t"                          \
+  "mulxq 24(%[m]), %[lo], %[hi]\n\t"                    \
+  "adoxq %[lo], %[" T3 "]\n\t"                          \
+  "adoxq %%rax, %[hi]\n\t"                              \
+  "adcxq %%rax, %[hi]\n\t"                              \
+  "addq %[c], %[c]\n\t"                                 \
+  "adcq %[hi], %[" T4 "]\n\t"                           \
+  "sbbq %[c], %[c]\n\t"
+
+// Computes |t| * R⁻¹ mod |modulus| of a 512-bit |t|, where R is 2²⁵⁶ and
+// |inverse| is -|modulus|⁻¹ mod 2⁶⁴. This is the reduction half of
+// |MontMul4()| and returns the carry out of 256 bits in the same way.
+ALWAYS_INLINE bool MontReduce4(const BigInt<8>& t, const BigInt<4>& modulus,
+                               uint64_t inverse, BigInt<4>* r) {
+  uint64_t t0 = t[0], t1 = t[1], t2 = t[2], t3 = t[3], t4 = t[4], t5 = t[5],
+           t6 = t[6], t7 = t[7];
+  uint64_t c = 0;
+  uint64_t lo, hi;
+  // clang-format off
+  __asm__(
+      TACHYON_MULX_ADX_REDUCE_ROW("t0", "t1", "t2", "t3", "t4")
+      TACHYON_MULX_ADX_REDUCE_ROW("t1", "t2", "t3", "t4", "t5")
+      TACHYON_MULX_ADX_REDUCE_ROW("t2", "t3", "t4", "t5", "t6")
+      TACHYON_MULX_ADX_REDUCE_ROW("t3", "t4", "t5", "t6", "t7")
+      : [t0] "+&r"(t0), [t1] "+&r"(t1), [t2] "+&r"(t2), [t3] "+&r"(t3),
+        [t4] "+&r"(t4), [t5] "+&r"(t5), [t6] "+&r"(t6), [t7] "+&r"(t7),
+        [c] "+&r"(c), [lo] "=&r"(lo), [hi] "=&r"(hi)
+      : [m] "r"(modulus.limbs), [inverse] "m"(inverse)
+      : "rax", "rdx", "cc", "memory");
+  // clang-format on
+  (*r)[0] = t4;
+  (*r)[1] = t5;
+  (*r)[2] = t6;
+  (*r)[3] = t7;
+  return c != 0;
+}
+
+#undef TACHYON_MULX_ADX_REDUCE_ROW
+#undef TACHYON_MULX_ADX_ROW
+#undef TACHYON_MULX_ADX_ITERATION
+#undef TACHYON_MULX_ADX_MUL_ADD
+
+}  // namespace tachyon::math::internal::mulx_adx
+
+#endif  // defined(TACHYON_HAS_MULX_ADX)
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_PRIME_FIELD_MULX_ADX_H_
@@ -0,0 +1,268 @@
+#ifndef TACHYON_MATH_FINITE_FIELDS_SAFEGCD_H_
+#define TACHYON_MATH_FINITE_FIELDS_SAFEGCD_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+#include "absl/numeric/int128.h"
+
+#include "tachyon/base/logging.h"
+#include "tachyon/math/base/big_int.h"
+
+namespace tachyon::math {
+namespace internal {
+
+constexpr uint64_t kMask62 = (uint64_t{1} << 62) - 1;
+
+// The number of signed 62-bit limbs for |N| limbs, which leaves room for 2 *
+// modulus and a sign.
+constexpr size_t GetSigned62LimbNums(size_t n) {
+  return (64 * n + 2 + 61) / 62;
+}
+
+template <size_t N>
+using Signed62 = std::array<int64_t, GetSigned62LimbNums(N)>;
+
+template <size_t N>
+constexpr Signed62<N> ToSigned62(const BigInt<N>& a) {
+  Signed62<N> ret{};
+  for (size_t i = 0; i < ret.size(); ++i) {
+    size_t limb = 62 * i / 64;
+    size_t shift = 62 * i % 64;
+    if (limb >= N) break;
+    uint64_t value = a[limb] >> shift;
+    if (shift > 2 && limb + 1 < N) {
+      value |= a[limb + 1] << (64 - shift);
+    }
+    ret[i] = static_cast<int64_t>(value & kMask62);
+  }
+  return ret;
+}
+
+// |a| must be normalized, that is, every limb is in [0, 2⁶²).
+template <size_t N>
+constexpr BigInt<N> FromSigned62(const Signed62<N>& a) {
+  BigInt<N> ret;
+  for (size_t i = 0; i < N; ++i) {
+    size_t limb = 64 * i / 62;
+    size_t shift = 64 * i % 62;
+    uint64_t value = static_cast<uint64_t>(a[limb]) >> shift;
+    if (limb + 1 < a.size()) {
+      value |= static_cast<uint64_t>(a[limb + 1]) << (62 - shift);
+    }
+    ret[i] = value;
+  }
+  return ret;
+}
+
+}  // namespace internal
+
+// |SafeGcd| inverts an element modulo |Config::kModulus| with the
+// Bernstein–Yang safegcd algorithm. It runs a fixed number of divsteps which
+// depends only on the number of bits of the modulus, and every divstep is
+// computed with masks instead of branches, so that the time it takes doesn't
+// depend on the input. The divsteps are batched 62 at a time on the bottom 64
+// bits of f and g, and then the 2x2 transition matrix of the batch is applied
+// to the full f, g, d and e. This is taken and modified from
+// https://github.com/bitcoin-core/secp256k1/blob/master/src/modinv64_impl.h.
+// See https://gcd.cr.yp.to/safegcd-20190413.pdf and
+// https://github.com/bitcoin-core/secp256k1/blob/master/doc/safegcd_implementation.md.
+template <typename Config>
+class SafeGcd {
+ public:
+  constexpr static size_t N = decltype(Config::kModulus)::kLimbNums;
+  constexpr static size_t kLimbNums = internal::GetSigned62LimbNums(N);
+
+  // Returns |coeff| * |a|⁻¹ mod modulus. |a| must be less than the modulus
+  // and must not be zero. Passing R² as |coeff| inverts an element in
+  // Montgomery form without converting it.
+  static BigInt<N> Inverse(const BigInt<N>& a, const BigInt<N>& coeff) {
+    CHECK(!a.IsZero());
+
+    // The invariants are f * coeff ≡ d * a and g * coeff ≡ e * a. When f
+    // reaches ±1, d is ±|coeff| * |a|⁻¹.
+    Signed62 d{};
+    Signed62 e = internal::ToSigned62(coeff);
+    Signed62 f = kModulus62;
+    Signed62 g = internal::ToSigned62(a);
+    int64_t delta = 1;
+    for (size_t i = 0; i < kIterations; ++i) {
+      Matrix t;
+      delta = Divsteps62(delta, static_cast<uint64_t>(f[0]),
+                         static_cast<uint64_t>(g[0]), &t);
+      UpdateDE(t, &d, &e);
+      UpdateFG(t, &f, &g);
+    }
+    Normalize(f[kLimbNums - 1], &d);
+    return internal::FromSigned62<N>(d);
+  }
+
+ private:
+  using Signed62 = internal::Signed62<N>;
+
+  // The transition matrix of 62 divsteps, scaled by 2⁶².
+  struct Matrix {
+    int64_t u;
+    int64_t v;
+    int64_t q;
+    int64_t r;
+  };
+
+  constexpr static uint64_t kMask62 = internal::kMask62;
+
+  // The number of divsteps which are enough for any input less than 2ᵇ,
+  // where b is the number of bits of the modulus. See Theorem 11.2 of the
+  // paper.
+  constexpr static size_t kDivsteps =
+      Config::kModulusBits < 46 ? (49 * Config::kModulusBits + 80) / 17
+                                : (49 * Config::kModulusBits + 57) / 17;
+  constexpr static size_t kIterations = (kDivsteps + 61) / 62;
+
+  // -modulus⁻¹ mod 2⁶⁴ is |Config::kInverse64|, so modulus⁻¹ mod 2⁶² is its
+  // negation.
+  constexpr static uint64_t kModulusInverse62 =
+      (uint64_t{0} - Config::kInverse64) & kMask62;
+  constexpr static Signed62 kModulus62 =
+      internal::ToSigned62(Config::kModulus);
+
+  // Runs 62 divsteps on the bottom 64 bits of f and g and returns the new
+  // delta. A divstep maps (δ, f, g) to (1 - δ, g, (g - f) / 2) if δ > 0 and g
+  // is odd, and to (1 + δ, f, (g + (g mod 2) * f) / 2) otherwise.
+  static int64_t Divsteps62(int64_t delta, uint64_t f, uint64_t g,
+                            Matrix* t) {
+    uint64_t u = 1, v = 0, q = 0, r = 1;
+    for (size_t i = 0; i < 62; ++i) {
+      // All ones if δ > 0.
+      uint64_t c1 = static_cast<uint64_t>(-delta >> 63);
+      // All ones if g is odd.
+      uint64_t c2 = uint64_t{0} - (g & 1);
+      // Conditionally negates f, u and v and adds them to g, q and r.
+      uint64_t x = (f ^ c1) - c1;
+      uint64_t y = (u ^ c1) - c1;
+      uint64_t z = (v ^ c1) - c1;
+      g += x & c2;
+      q += y & c2;
+      r += z & c2;
+      // All ones if both hold, where f and g are swapped. Since g is g - f
+      // now, f + g is the old g.
+      c1 &= c2;
+      delta = (delta ^ static_cast<int64_t>(c1)) - static_cast<int64_t>(c1);
+      f += g & c1;
+      u += q & c1;
+      v += r & c1;
+      // g is halved, which is done by doubling u and v instead, so that the
+      // matrix stays integral.
+      g >>= 1;
+      u <<= 1;
+      v <<= 1;
+      ++delta;
+    }
+    t->u = static_cast<int64_t>(u);
+    t->v = static_cast<int64_t>(v);
+    t->q = static_cast<int64_t>(q);
+    t->r = static_cast<int64_t>(r);
+    return delta;
+  }
+
+  // Computes [d, e] = t * [d, e] / 2⁶² mod modulus, adding the multiples of
+  // the modulus which make the bottom 62 bits zero. d and e stay in
+  // (-2 * modulus, modulus).
+  static void UpdateDE(const Matrix& t, Signed62* d, Signed62* e) {
+    int64_t sd = (*d)[kLimbNums - 1] >> 63;
+    int64_t se = (*e)[kLimbNums - 1] >> 63;
+    // The multiples start as [u, q] if d is negative plus [v, r] if e is
+    // negative, which keeps the result from going below -2 * modulus.
+    int64_t md = (t.u & sd) + (t.v & se);
+    int64_t me = (t.q & sd) + (t.r & se);
+    absl::int128 cd =
+        absl::int128(t.u) * (*d)[0] + absl::int128(t.v) * (*e)[0];
+    absl::int128 ce =
+        absl::int128(t.q) * (*d)[0] + absl::int128(t.r) * (*e)[0];
+    md -= static_cast<int64_t>(
+        (kModulusInverse62 * absl::Uint128Low64(absl::uint128(cd)) +
+         static_cast<uint64_t>(md)) &
+        kMask62);
+    me -= static_cast<int64_t>(
+        (kModulusInverse62 * absl::Uint128Low64(absl::uint128(ce)) +
+         static_cast<uint64_t>(me)) &
+        kMask62);
+    cd += absl::int128(kModulus62[0]) * md;
+    ce += absl::int128(kModulus62[0]) * me;
+    DCHECK_EQ(absl::Uint128Low64(absl::uint128(cd)) & kMask62, uint64_t{0});
+    DCHECK_EQ(absl::Uint128Low64(absl::uint128(ce)) & kMask62, uint64_t{0});
+    cd >>= 62;
+    ce >>= 62;
+    for (size_t i = 1; i < kLimbNums; ++i) {
+      cd += absl::int128(t.u) * (*d)[i] + absl::int128(t.v) * (*e)[i] +
+            absl::int128(kModulus62[i]) * md;
+      ce += absl::int128(t.q) * (*d)[i] + absl::int128(t.r) * (*e)[i] +
+            absl::int128(kModulus62[i]) * me;
+      (*d)[i - 1] = static_cast<int64_t>(
+          absl::Uint128Low64(absl::uint128(cd)) & kMask62);
+      (*e)[i - 1] = static_cast<int64_t>(
+          absl::Uint128Low64(absl::uint128(ce)) & kMask62);
+      cd >>= 62;
+      ce >>= 62;
+    }
+    (*d)[kLimbNums - 1] = static_cast<int64_t>(cd);
+    (*e)[kLimbNums - 1] = static_cast<int64_t>(ce);
+  }
+
+  // Computes [f, g] = t * [f, g] / 2⁶², where the division is exact.
+  static void UpdateFG(const Matrix& t, Signed62* f, Signed62* g) {
+    absl::int128 cf =
+        absl::int128(t.u) * (*f)[0] + absl::int128(t.v) * (*g)[0];
+    absl::int128 cg =
+        absl::int128(t.q) * (*f)[0] + absl::int128(t.r) * (*g)[0];
+    DCHECK_EQ(absl::Uint128Low64(absl::uint128(cf)) & kMask62, uint64_t{0});
+    DCHECK_EQ(absl::Uint128Low64(absl::uint128(cg)) & kMask62, uint64_t{0});
+    cf >>= 62;
+    cg >>= 62;
+    for (size_t i = 1; i < kLimbNums; ++i) {
+      cf += absl::int128(t.u) * (*f)[i] + absl::int128(t.v) * (*g)[i];
+      cg += absl::int128(t.q) * (*f)[i] + absl::int128(t.r) * (*g)[i];
+      (*f)[i - 1] = static_cast<int64_t>(
+          absl::Uint128Low64(absl::uint128(cf)) & kMask62);
+      (*g)[i - 1] = static_cast<int64_t>(
+          absl::Uint128Low64(absl::uint128(cg)) & kMask62);
+      cf >>= 62;
+      cg >>= 62;
+    }
+    (*f)[kLimbNums - 1] = static_cast<int64_t>(cf);
+    (*g)[kLimbNums - 1] = static_cast<int64_t>(cg);
+  }
+
+  // Brings |a| from (-2 * modulus, modulus) to [0, modulus), negating it if
+  // |sign| is negative, which is the top limb of f = ±1.
+  static void Normalize(int64_t sign, Signed62* a) {
+    // Adds the modulus if |a| is negative and negates it if asked, which
+    // brings it to (-modulus, modulus).
+    int64_t cond_add = (*a)[kLimbNums - 1] >> 63;
+    int64_t cond_negate = sign >> 63;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      int64_t limb = (*a)[i] + (kModulus62[i] & cond_add);
+      (*a)[i] = (limb ^ cond_negate) - cond_negate;
+    }
+    Propagate(a);
+    // Adds the modulus again if it is still negative.
+    cond_add = (*a)[kLimbNums - 1] >> 63;
+    for (size_t i = 0; i < kLimbNums; ++i) {
+      (*a)[i] += kModulus62[i] & cond_add;
+    }
+    Propagate(a);
+  }
+
+  // Carries the bits above 62 of each limb into the next one.
+  static void Propagate(Signed62* a) {
+    for (size_t i = 0; i + 1 < kLimbNums; ++i) {
+      (*a)[i + 1] += (*a)[i] >> 62;
+      (*a)[i] &= static_cast<int64_t>(kMask62);
+    }
+  }
+};
+
+}  // namespace tachyon::math
+
+#endif  // TACHYON_MATH_FINITE_FIELDS_SAFEGCD_H_
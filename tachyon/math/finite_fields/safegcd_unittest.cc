@@ -0,0 +1,73 @@
+#include "tachyon/math/finite_fields/safegcd.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "tachyon/math/elliptic_curves/bls/bls12_381/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fq.h"
+#include "tachyon/math/elliptic_curves/bn/bn254/fr.h"
+#include "tachyon/math/elliptic_curves/secp/secp256k1/fq.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
+#include "tachyon/math/finite_fields/test/gf7.h"
+
+namespace tachyon::math {
+
+namespace {
+
+constexpr size_t kTestNum = 100;
+
+template <typename PrimeFieldType>
+class SafeGcdTest : public testing::Test {
+ public:
+  using F = PrimeFieldType;
+
+  void SetUp() override {
+    // The edge cases come first and the rest are random.
+    as_ = {F::One(), -F::One(), F::One().Double()};
+    while (as_.size() < kTestNum) {
+      F a = F::Random();
+      if (!a.IsZero()) as_.push_back(a);
+    }
+  }
+
+ protected:
+  std::vector<F> as_;
+};
+
+}  // namespace
+
+// bls12_381::Fq has 6 limbs and secp256k1::Fq has no spare bit.
+using PrimeFieldTypes =
+    testing::Types<GF7, Goldilocks, bn254::Fr, bn254::Fq, secp256k1::Fq,
+                   bls12_381::Fq>;
+TYPED_TEST_SUITE(SafeGcdTest, PrimeFieldTypes);
+
+TYPED_TEST(SafeGcdTest, Inverse) {
+  using F = TypeParam;
+  using Config = typename F::Config;
+
+  for (const F& a : this->as_) {
+    BigInt<F::N> expected =
+        a.value().template MontgomeryInverse<Config::kModulusHasSpareBit>(
+            Config::kModulus, Config::kMontgomeryR2);
+    EXPECT_EQ(SafeGcd<Config>::Inverse(a.value(), Config::kMontgomeryR2),
+              expected);
+  }
+}
+
+TYPED_TEST(SafeGcdTest, InverseWithCoeff) {
+  using F = TypeParam;
+  using Config = typename F::Config;
+
+  // With R as the coefficient, the result is a⁻¹ itself rather than its
+  // Montgomery form, which is the Montgomery form of a⁻¹ * R⁻¹.
+  F r_inverse = F::FromBigInt(Config::kMontgomeryR).Inverse();
+  for (const F& a : this->as_) {
+    F inverse = F::FromMontgomery(
+        SafeGcd<Config>::Inverse(a.value(), Config::kMontgomeryR));
+    EXPECT_EQ(inverse, a.Inverse() * r_inverse);
+  }
+}
+
+}  // namespace tachyon::math
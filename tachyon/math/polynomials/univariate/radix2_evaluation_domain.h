@@ -15,6 +15,7 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <array>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -26,6 +27,7 @@
 #include "tachyon/base/containers/adapters.h"
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/logging.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/univariate_polynomial.h"
 
@@ -213,6 +215,13 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
       static_assert(Order == FFTOrder::kOutIn);
       fn = UnivariateEvaluationDomain<F, MaxDegree>::ButterflyFnOutIn;
     }
+    if constexpr (PackedPrimeField<F>::kIsVectorized) {
+      if (CanApplyPackedButterfly(roots, step, gap)) {
+        ApplyPackedButterfly<Order>(poly_or_evals, roots, step, chunk_size,
+                                    thread_nums, gap);
+        return;
+      }
+    }
     OPENMP_PARALLEL_FOR(size_t i = 0; i <= poly_or_evals.Degree();
                         i += chunk_size) {
       // If the chunk is sufficiently big that parallelism helps,
@@ -232,6 +241,62 @@ class Radix2EvaluationDomain : public UnivariateEvaluationDomain<F, MaxDegree> {
     }
   }
 
+  // Returns true if the butterflies of a chunk can be applied
+  // |PackedPrimeField<F>::kLanes| at a time, that is, if |gap| is a multiple
+  // of the lanes and every butterfly has its root.
+  constexpr static bool CanApplyPackedButterfly(absl::Span<const F> roots,
+                                                size_t step, size_t gap) {
+    return gap % PackedPrimeField<F>::kLanes == 0 &&
+           (gap - 1) * step < roots.size();
+  }
+
+  // Same as |ApplyButterfly()|, but applies the butterflies to
+  // |PackedPrimeField<F>::kLanes| pairs at once.
+  template <FFTOrder Order, typename PolyOrEvals>
+  static void ApplyPackedButterfly(PolyOrEvals& poly_or_evals,
+                                   absl::Span<const F> roots, size_t step,
+                                   size_t chunk_size, size_t thread_nums,
+                                   size_t gap) {
+    using Packed = PackedPrimeField<F>;
+
+    auto fn = [&roots, step, gap](F* chunk, size_t j) {
+      Packed root;
+      if (step == 1) {
+        root = Packed::Load(&roots[j]);
+      } else {
+        std::array<F, Packed::kLanes> strided_roots;
+        for (size_t k = 0; k < Packed::kLanes; ++k) {
+          strided_roots[k] = roots[(j + k) * step];
+        }
+        root = Packed::Load(strided_roots.data());
+      }
+      Packed lo = Packed::Load(&chunk[j]);
+      Packed hi = Packed::Load(&chunk[j + gap]);
+      if constexpr (Order == FFTOrder::kInOut) {
+        (lo + hi).Store(&chunk[j]);
+        ((lo - hi) * root).Store(&chunk[j + gap]);
+      } else {
+        static_assert(Order == FFTOrder::kOutIn);
+        hi *= root;
+        (lo + hi).Store(&chunk[j]);
+        (lo - hi).Store(&chunk[j + gap]);
+      }
+    };
+    OPENMP_PARALLEL_FOR(size_t i = 0; i <= poly_or_evals.Degree();
+                        i += chunk_size) {
+      F* chunk = poly_or_evals[i];
+      if (gap > kMinGapSizeForParallelization && chunk_size < thread_nums) {
+        OPENMP_PARALLEL_FOR(size_t j = 0; j < gap; j += Packed::kLanes) {
+          fn(chunk, j);
+        }
+      } else {
+        for (size_t j = 0; j < gap; j += Packed::kLanes) {
+          fn(chunk, j);
+        }
+      }
+    }
+  }
+
   constexpr void InOutHelper(DensePoly& poly, const F& root) const {
     std::vector<F> roots = this->GetRootsOfUnity(this->size_ / 2, root);
     size_t step = 1;
@@ -8,7 +8,6 @@
 
 #include <stddef.h>
 
-#include <functional>
 #include <numeric>
 #include <sstream>
 #include <string>
@@ -159,23 +158,23 @@ class UnivariateDenseCoefficients {
     // 1) Split up the coefficients across each thread evenly.
     // 2) Do polynomial evaluation via Horner's method for the thread's
     // coefficients
-    // 3) Scale the result point^{thread coefficient start index}
-    // Then obtain the final polynomial evaluation by summing each threads
-    // result.
+    // 3) Compute point^{thread coefficient start index}
+    // Then obtain the final polynomial evaluation by summing the products of
+    // each threads result and its power, which |F::SumOfProducts()| reduces
+    // at once.
     auto chunks = base::Chunked(coefficients_, num_coeffs_per_thread);
     std::vector<absl::Span<const F>> chunks_vector =
         base::Map(chunks.begin(), chunks.end(),
                   [](const absl::Span<const F>& chunk) { return chunk; });
     std::vector<F> results =
         base::CreateVector(chunks_vector.size(), F::Zero());
+    std::vector<F> powers = base::CreateVector(chunks_vector.size(), F::Zero());
 #pragma omp parallel for
     for (size_t i = 0; i < chunks_vector.size(); ++i) {
-      F result = HornerEvaluate(chunks_vector[i], point);
-      result *= point.Pow(BigInt<1>(i * num_coeffs_per_thread));
-      results[i] = std::move(result);
+      results[i] = HornerEvaluate(chunks_vector[i], point);
+      powers[i] = point.Pow(BigInt<1>(i * num_coeffs_per_thread));
     }
-    return std::accumulate(results.begin(), results.end(), F::Zero(),
-                           std::plus<>());
+    return F::SumOfProducts(results, powers);
 #else
     return HornerEvaluate(absl::MakeConstSpan(coefficients_), point);
 #endif
@@ -10,6 +10,7 @@
 #include "tachyon/base/functional/function_ref.h"
 #include "tachyon/math/elliptic_curves/bls/bls12_381/fr.h"
 #include "tachyon/math/elliptic_curves/bn/bn384_small_two_adicity/fq.h"
+#include "tachyon/math/finite_fields/goldilocks_prime/goldilocks.h"
 #include "tachyon/math/polynomials/univariate/mixed_radix_evaluation_domain.h"
 #include "tachyon/math/polynomials/univariate/radix2_evaluation_domain.h"
 
@@ -49,6 +50,7 @@ class UnivariateEvaluationDomainTest : public testing::Test {
 
 using UnivariateEvaluationDomainTypes =
     testing::Types<Radix2EvaluationDomain<bls12_381::Fr>,
+                   Radix2EvaluationDomain<Goldilocks>,
                    MixedRadixEvaluationDomain<bn384_small_two_adicity::Fq>>;
 TYPED_TEST_SUITE(UnivariateEvaluationDomainTest,
                  UnivariateEvaluationDomainTypes);
@@ -96,7 +98,8 @@ TYPED_TEST(UnivariateEvaluationDomainTest, FilterPolynomial) {
       UnivariateEvaluationDomain<F, UnivariateEvaluationDomainType::kMaxDegree>;
   using DensePoly = typename UnivariateEvaluationDomainType::DensePoly;
 
-  if constexpr (std::is_same_v<F, bls12_381::Fr>) {
+  if constexpr (std::is_same_v<UnivariateEvaluationDomainType,
+                               Radix2EvaluationDomain<F>>) {
     for (size_t log_domain_size = 1; log_domain_size < 4; ++log_domain_size) {
       size_t domain_size = size_t{1} << log_domain_size;
       std::unique_ptr<UnivariateEvaluationDomainType> domain =
@@ -108,11 +111,11 @@ TYPED_TEST(UnivariateEvaluationDomainTest, FilterPolynomial) {
             UnivariateEvaluationDomainType::Create(subdomain_size);
 
         // Obtain all possible offsets of |subdomain| within |domain|.
-        std::vector<bls12_381::Fr> possible_offsets = {bls12_381::Fr::One()};
-        const bls12_381::Fr& domain_generator = domain->group_gen();
+        std::vector<F> possible_offsets = {F::One()};
+        const F& domain_generator = domain->group_gen();
 
-        bls12_381::Fr offset = domain_generator;
-        const bls12_381::Fr& subdomain_generator = subdomain->group_gen();
+        F offset = domain_generator;
+        const F& subdomain_generator = subdomain->group_gen();
         while (offset != subdomain_generator) {
           possible_offsets.push_back(offset);
           offset *= domain_generator;
@@ -120,15 +123,14 @@ TYPED_TEST(UnivariateEvaluationDomainTest, FilterPolynomial) {
         EXPECT_EQ(possible_offsets.size(), domain_size / subdomain_size);
 
         // Get all possible cosets of |subdomain| within |domain|.
-        for (const bls12_381::Fr& offset : possible_offsets) {
+        for (const F& offset : possible_offsets) {
           std::unique_ptr<BaseUnivariateEvaluationDomainType> coset =
               subdomain->GetCoset(offset);
-          std::vector<bls12_381::Fr> coset_elements = coset->GetElements();
+          std::vector<F> coset_elements = coset->GetElements();
           DensePoly filter_poly = domain->GetFilterPolynomial(*coset);
           EXPECT_EQ(filter_poly.Degree(), domain_size - subdomain_size);
-          for (const bls12_381::Fr& element : domain->GetElements()) {
-            bls12_381::Fr evaluation =
-                domain->EvaluateFilterPolynomial(*coset, element);
+          for (const F& element : domain->GetElements()) {
+            F evaluation = domain->EvaluateFilterPolynomial(*coset, element);
             EXPECT_EQ(evaluation, filter_poly.Evaluate(element));
             if (base::Contains(coset_elements, element)) {
               EXPECT_TRUE(evaluation.IsOne());
@@ -284,7 +286,8 @@ TYPED_TEST(UnivariateEvaluationDomainTest, DegreeAwareFFTCorrectness) {
   using DensePoly = typename UnivariateEvaluationDomainType::DensePoly;
   using Evals = typename UnivariateEvaluationDomainType::Evals;
 
-  if constexpr (std::is_same_v<F, bls12_381::Fr>) {
+  if constexpr (std::is_same_v<UnivariateEvaluationDomainType,
+                               Radix2EvaluationDomain<F>>) {
     const size_t log_degree = 5;
     const size_t degree = (size_t{1} << log_degree) - 1;
     DensePoly rand_poly = DensePoly::Random(degree);
@@ -12,6 +12,7 @@
 
 #include "tachyon/base/containers/container_util.h"
 #include "tachyon/base/openmp_util.h"
+#include "tachyon/math/finite_fields/packed_prime_field.h"
 #include "tachyon/math/polynomials/univariate/univariate_evaluations.h"
 
 namespace tachyon::math {
@@ -56,7 +57,20 @@ class UnivariateEvaluationsOp {
     std::vector<F>& l_evaluations = self.evaluations_;
     const std::vector<F>& r_evaluations = other.evaluations_;
     CHECK_EQ(l_evaluations.size(), r_evaluations.size());
-    OPENMP_PARALLEL_FOR(size_t i = 0; i < l_evaluations.size(); ++i) {
+    size_t size = l_evaluations.size();
+    size_t start = 0;
+    using Packed = PackedPrimeField<F>;
+    if constexpr (Packed::kIsVectorized) {
+      size_t num_chunks = size / Packed::kLanes;
+      OPENMP_PARALLEL_FOR(size_t i = 0; i < num_chunks; ++i) {
+        size_t offset = i * Packed::kLanes;
+        (Packed::Load(&l_evaluations[offset]) *
+         Packed::Load(&r_evaluations[offset]))
+            .Store(&l_evaluations[offset]);
+      }
+      start = num_chunks * Packed::kLanes;
+    }
+    OPENMP_PARALLEL_FOR(size_t i = start; i < size; ++i) {
       l_evaluations[i] *= r_evaluations[i];
     }
     return self;
@@ -1,10 +1,28 @@
 #include "tachyon/rs/math/elliptic_curves/bn/bn254/msm.h"
 
 #include "tachyon/c/math/elliptic_curves/bn/bn254/msm.h"
+#include "tachyon/c/math/elliptic_curves/msm/msm_async.h"
 #include "tachyon/rs/src/math/elliptic_curves/bn/bn254/mod.rs.h"
 
 namespace tachyon::rs::math::bn254 {
 
+namespace {
+
+void WakeG1MSMJob(tachyon_bn254_g1_msm_job_ptr job, void* user_data) {
+  wake_g1_msm_job(*reinterpret_cast<const G1MSMJobWaker*>(user_data));
+}
+
+void* ToUserData(const G1MSMJobWaker& job_waker) {
+  return const_cast<G1MSMJobWaker*>(&job_waker);
+}
+
+tachyon_bn254_g1_msm_job_ptr ToCJob(const G1MSMJob& job) {
+  return reinterpret_cast<tachyon_bn254_g1_msm_job_ptr>(
+      const_cast<G1MSMJob*>(&job));
+}
+
+}  // namespace
+
 rust::Box<G1MSM> create_g1_msm(uint8_t degree) {
   return rust::Box<G1MSM>::from_raw(
       reinterpret_cast<G1MSM*>(tachyon_bn254_g1_create_msm(degree)));
@@ -39,4 +57,92 @@ rust::Box<G1JacobianPoint> g1_point2_msm(G1MSM* msm,
       reinterpret_cast<G1JacobianPoint*>(ret));
 }
 
+rust::Box<G1MSMBases> create_g1_msm_bases_from_affine(
+    rust::Slice<const G1AffinePoint> bases) {
+  auto ret = tachyon_bn254_g1_create_msm_bases_from_affine(
+      reinterpret_cast<const tachyon_bn254_g1_affine*>(bases.data()),
+      bases.length());
+  return rust::Box<G1MSMBases>::from_raw(reinterpret_cast<G1MSMBases*>(ret));
+}
+
+rust::Box<G1MSMBases> create_g1_msm_bases_from_point2(
+    rust::Slice<const G1Point2> bases) {
+  auto ret = tachyon_bn254_g1_create_msm_bases_from_point2(
+      reinterpret_cast<const tachyon_bn254_g1_point2*>(bases.data()),
+      bases.length());
+  return rust::Box<G1MSMBases>::from_raw(reinterpret_cast<G1MSMBases*>(ret));
+}
+
+void destroy_g1_msm_bases(rust::Box<G1MSMBases> bases) {
+  tachyon_bn254_g1_destroy_msm_bases(
+      reinterpret_cast<tachyon_bn254_g1_msm_bases_ptr>(bases.into_raw()));
+}
+
+rust::Box<G1JacobianPoint> g1_msm_with_bases(G1MSM* msm,
+                                             const G1MSMBases& bases,
+                                             rust::Slice<const Fr> scalars) {
+  auto ret = tachyon_bn254_g1_msm_with_bases(
+      reinterpret_cast<tachyon_bn254_g1_msm_ptr>(msm),
+      reinterpret_cast<tachyon_bn254_g1_msm_bases_ptr>(
+          const_cast<G1MSMBases*>(&bases)),
+      reinterpret_cast<const tachyon_bn254_fr*>(scalars.data()),
+      scalars.length());
+  return rust::Box<G1JacobianPoint>::from_raw(
+      reinterpret_cast<G1JacobianPoint*>(ret));
+}
+
+rust::Box<G1MSMJob> g1_affine_msm_async(rust::Slice<const G1AffinePoint> bases,
+                                        rust::Slice<const Fr> scalars,
+                                        const G1MSMJobWaker& job_waker) {
+  auto job = tachyon_bn254_g1_affine_msm_async(
+      reinterpret_cast<const tachyon_bn254_g1_affine*>(bases.data()),
+      reinterpret_cast<const tachyon_bn254_fr*>(scalars.data()),
+      scalars.length(), WakeG1MSMJob, ToUserData(job_waker));
+  return rust::Box<G1MSMJob>::from_raw(reinterpret_cast<G1MSMJob*>(job));
+}
+
+rust::Box<G1MSMJob> g1_point2_msm_async(rust::Slice<const G1Point2> bases,
+                                        rust::Slice<const Fr> scalars,
+                                        const G1MSMJobWaker& job_waker) {
+  auto job = tachyon_bn254_g1_point2_msm_async(
+      reinterpret_cast<const tachyon_bn254_g1_point2*>(bases.data()),
+      reinterpret_cast<const tachyon_bn254_fr*>(scalars.data()),
+      scalars.length(), WakeG1MSMJob, ToUserData(job_waker));
+  return rust::Box<G1MSMJob>::from_raw(reinterpret_cast<G1MSMJob*>(job));
+}
+
+rust::Box<G1MSMJob> g1_msm_with_bases_async(const G1MSMBases& bases,
+                                            rust::Slice<const Fr> scalars,
+                                            const G1MSMJobWaker& job_waker) {
+  auto job = tachyon_bn254_g1_msm_with_bases_async(
+      reinterpret_cast<tachyon_bn254_g1_msm_bases_ptr>(
+          const_cast<G1MSMBases*>(&bases)),
+      reinterpret_cast<const tachyon_bn254_fr*>(scalars.data()),
+      scalars.length(), WakeG1MSMJob, ToUserData(job_waker));
+  return rust::Box<G1MSMJob>::from_raw(reinterpret_cast<G1MSMJob*>(job));
+}
+
+bool g1_msm_job_poll(const G1MSMJob& job) {
+  return tachyon_bn254_g1_msm_job_poll(ToCJob(job));
+}
+
+rust::Box<G1JacobianPoint> g1_msm_job_wait(const G1MSMJob& job) {
+  auto ret = tachyon_bn254_g1_msm_job_wait(ToCJob(job));
+  return rust::Box<G1JacobianPoint>::from_raw(
+      reinterpret_cast<G1JacobianPoint*>(ret));
+}
+
+void destroy_g1_msm_job(rust::Box<G1MSMJob> job) {
+  tachyon_bn254_g1_destroy_msm_job(
+      reinterpret_cast<tachyon_bn254_g1_msm_job_ptr>(job.into_raw()));
+}
+
+size_t get_msm_async_max_concurrency() {
+  return tachyon_msm_async_get_max_concurrency();
+}
+
+void set_msm_async_max_concurrency(size_t max_concurrency) {
+  tachyon_msm_async_set_max_concurrency(max_concurrency);
+}
+
 }  // namespace tachyon::rs::math::bn254
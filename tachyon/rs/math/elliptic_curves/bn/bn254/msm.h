@@ -6,6 +6,9 @@
 namespace tachyon::rs::math::bn254 {
 
 struct G1MSM;
+struct G1MSMBases;
+struct G1MSMJob;
+struct G1MSMJobWaker;
 
 struct G1AffinePoint;
 struct G1JacobianPoint;
@@ -24,6 +27,40 @@ rust::Box<G1JacobianPoint> g1_point2_msm(G1MSM* msm,
                                          rust::Slice<const G1Point2> bases,
                                          rust::Slice<const Fr> scalars);
 
+rust::Box<G1MSMBases> create_g1_msm_bases_from_affine(
+    rust::Slice<const G1AffinePoint> bases);
+
+rust::Box<G1MSMBases> create_g1_msm_bases_from_point2(
+    rust::Slice<const G1Point2> bases);
+
+void destroy_g1_msm_bases(rust::Box<G1MSMBases> bases);
+
+rust::Box<G1JacobianPoint> g1_msm_with_bases(G1MSM* msm,
+                                             const G1MSMBases& bases,
+                                             rust::Slice<const Fr> scalars);
+
+rust::Box<G1MSMJob> g1_affine_msm_async(rust::Slice<const G1AffinePoint> bases,
+                                        rust::Slice<const Fr> scalars,
+                                        const G1MSMJobWaker& job_waker);
+
+rust::Box<G1MSMJob> g1_point2_msm_async(rust::Slice<const G1Point2> bases,
+                                        rust::Slice<const Fr> scalars,
+                                        const G1MSMJobWaker& job_waker);
+
+rust::Box<G1MSMJob> g1_msm_with_bases_async(const G1MSMBases& bases,
+                                            rust::Slice<const Fr> scalars,
+                                            const G1MSMJobWaker& job_waker);
+
+bool g1_msm_job_poll(const G1MSMJob& job);
+
+rust::Box<G1JacobianPoint> g1_msm_job_wait(const G1MSMJob& job);
+
+void destroy_g1_msm_job(rust::Box<G1MSMJob> job);
+
+size_t get_msm_async_max_concurrency();
+
+void set_msm_async_max_concurrency(size_t max_concurrency);
+
 }  // namespace tachyon::rs::math::bn254
 
 #endif  // TACHYON_RS_MATH_ELLIPTIC_CURVES_BN_BN254_MSM_H_
@@ -1,3 +1,11 @@
+use std::{
+    future::Future,
+    marker::PhantomData,
+    pin::Pin,
+    sync::Mutex,
+    task::{Context, Poll, Waker},
+};
+
 use crate::math::{
     elliptic_curves::{AffinePoint, JacobianPoint, PointXYZZ, ProjectivePoint},
     finite_fields::PrimeField,
@@ -18,17 +26,120 @@ pub type G1Point4 = Point4<Fq>;
 
 pub struct G1MSM;
 
+pub struct G1MSMBases;
+
+pub struct G1MSMJob;
+
+/// Wakes the task polling a `G1MSMFuture` when its MSM finishes. It is called
+/// on a worker thread of tachyon.
+pub struct G1MSMJobWaker {
+    waker: Mutex<Option<Waker>>,
+}
+
+fn wake_g1_msm_job(job_waker: &G1MSMJobWaker) {
+    if let Some(waker) = job_waker.waker.lock().unwrap().take() {
+        waker.wake();
+    }
+}
+
+/// A future of an MSM running on the worker pool of tachyon. Dropping it
+/// blocks until the MSM finishes, since the MSM reads the borrowed inputs.
+pub struct G1MSMFuture<'a> {
+    job: Option<Box<G1MSMJob>>,
+    job_waker: Box<G1MSMJobWaker>,
+    _inputs: PhantomData<&'a [Fr]>,
+}
+
+impl<'a> G1MSMFuture<'a> {
+    /// # Safety
+    ///
+    /// The future must not be leaked, e.g., by `std::mem::forget()`, since the
+    /// MSM keeps reading `bases` and `scalars` until it finishes.
+    pub unsafe fn from_affine(bases: &'a [G1AffinePoint], scalars: &'a [Fr]) -> Self {
+        let job_waker = Box::new(G1MSMJobWaker {
+            waker: Mutex::new(None),
+        });
+        let job = ffi::g1_affine_msm_async(bases, scalars, &job_waker);
+        Self {
+            job: Some(job),
+            job_waker,
+            _inputs: PhantomData,
+        }
+    }
+
+    /// # Safety
+    ///
+    /// See `from_affine()`.
+    pub unsafe fn from_point2(bases: &'a [G1Point2], scalars: &'a [Fr]) -> Self {
+        let job_waker = Box::new(G1MSMJobWaker {
+            waker: Mutex::new(None),
+        });
+        let job = ffi::g1_point2_msm_async(bases, scalars, &job_waker);
+        Self {
+            job: Some(job),
+            job_waker,
+            _inputs: PhantomData,
+        }
+    }
+
+    /// # Safety
+    ///
+    /// See `from_affine()`. `bases` must hold at least as many bases as
+    /// `scalars`.
+    pub unsafe fn with_bases(bases: &'a G1MSMBases, scalars: &'a [Fr]) -> Self {
+        let job_waker = Box::new(G1MSMJobWaker {
+            waker: Mutex::new(None),
+        });
+        let job = ffi::g1_msm_with_bases_async(bases, scalars, &job_waker);
+        Self {
+            job: Some(job),
+            job_waker,
+            _inputs: PhantomData,
+        }
+    }
+}
+
+impl<'a> Future for G1MSMFuture<'a> {
+    type Output = Box<G1JacobianPoint>;
+
+    fn poll(self: Pin<&mut Self>, cx: &mut Context<'_>) -> Poll<Self::Output> {
+        let this = self.get_mut();
+        // The waker is registered before checking the job, so that a job
+        // which finishes in between still wakes the task.
+        *this.job_waker.waker.lock().unwrap() = Some(cx.waker().clone());
+        let job = this.job.as_ref().unwrap();
+        if ffi::g1_msm_job_poll(job) {
+            Poll::Ready(ffi::g1_msm_job_wait(job))
+        } else {
+            Poll::Pending
+        }
+    }
+}
+
+impl<'a> Drop for G1MSMFuture<'a> {
+    fn drop(&mut self) {
+        if let Some(job) = self.job.take() {
+            ffi::destroy_g1_msm_job(job);
+        }
+    }
+}
+
 pub struct G1MSMGpu;
 
 #[cxx::bridge(namespace = "tachyon::rs::math::bn254")]
 pub mod ffi {
     extern "Rust" {
         type G1MSM;
+        type G1MSMBases;
+        type G1MSMJob;
+        type G1MSMJobWaker;
         type G1MSMGpu;
         type G1AffinePoint;
         type G1JacobianPoint;
         type G1Point2;
         type Fr;
+
+        fn wake_g1_msm_job(job_waker: &G1MSMJobWaker);
     }
 
     unsafe extern "C++" {
@@ -48,6 +159,34 @@ pub mod ffi {
             bases: &[G1Point2],
             scalars: &[Fr],
         ) -> Box<G1JacobianPoint>;
+        fn create_g1_msm_bases_from_affine(bases: &[G1AffinePoint]) -> Box<G1MSMBases>;
+        fn create_g1_msm_bases_from_point2(bases: &[G1Point2]) -> Box<G1MSMBases>;
+        fn destroy_g1_msm_bases(bases: Box<G1MSMBases>);
+        unsafe fn g1_msm_with_bases(
+            msm: *mut G1MSM,
+            bases: &G1MSMBases,
+            scalars: &[Fr],
+        ) -> Box<G1JacobianPoint>;
+        unsafe fn g1_affine_msm_async(
+            bases: &[G1AffinePoint],
+            scalars: &[Fr],
+            job_waker: &G1MSMJobWaker,
+        ) -> Box<G1MSMJob>;
+        unsafe fn g1_point2_msm_async(
+            bases: &[G1Point2],
+            scalars: &[Fr],
+            job_waker: &G1MSMJobWaker,
+        ) -> Box<G1MSMJob>;
+        unsafe fn g1_msm_with_bases_async(
+            bases: &G1MSMBases,
+            scalars: &[Fr],
+            job_waker: &G1MSMJobWaker,
+        ) -> Box<G1MSMJob>;
+        fn g1_msm_job_poll(job: &G1MSMJob) -> bool;
+        fn g1_msm_job_wait(job: &G1MSMJob) -> Box<G1JacobianPoint>;
+        fn destroy_g1_msm_job(job: Box<G1MSMJob>);
+        fn get_msm_async_max_concurrency() -> usize;
+        fn set_msm_async_max_concurrency(max_concurrency: usize);
         #[cfg(feature = "gpu")]
         fn create_g1_msm_gpu(degree: u8, algorithm: i32) -> Box<G1MSMGpu>;
         #[cfg(feature = "gpu")]
@@ -5,8 +5,17 @@ mod test {
         bn256::{Fr, G1Affine, G1},
         group::{ff::Field, Curve, Group},
     };
-    use std::{mem, time::Instant};
-    use tachyon_rs::math::elliptic_curves::bn::bn254::{ffi, Fr as CppFr, G1Point2 as CppG1Point2};
+    use std::{
+        future::Future,
+        mem,
+        sync::Arc,
+        task::{Context, Poll, Wake},
+        thread::{self, Thread},
+        time::Instant,
+    };
+    use tachyon_rs::math::elliptic_curves::bn::bn254::{
+        ffi, Fr as CppFr, G1MSMFuture, G1Point2 as CppG1Point2,
+    };
 
     struct Timer {
         now: Instant,
@@ -28,6 +37,26 @@ mod test {
         }
     }
 
+    struct ThreadWaker(Thread);
+
+    impl Wake for ThreadWaker {
+        fn wake(self: Arc<Self>) {
+            self.0.unpark();
+        }
+    }
+
+    fn block_on<F: Future>(future: F) -> F::Output {
+        let mut future = Box::pin(future);
+        let waker = Arc::new(ThreadWaker(thread::current())).into();
+        let mut cx = Context::from_waker(&waker);
+        loop {
+            match future.as_mut().poll(&mut cx) {
+                Poll::Ready(ret) => return ret,
+                Poll::Pending => thread::park(),
+            }
+        }
+    }
+
     struct TestSet {
         bases: Vec<G1Affine>,
         scalars: Vec<Fr>,
@@ -81,6 +110,67 @@ mod test {
         }
     }
 
+    #[test]
+    fn test_msm_with_bases() {
+        let degree = 10;
+        let n = 1usize << degree;
+
+        let test_set = TestSet::create(n);
+
+        let expected = best_multiexp(&test_set.scalars, &test_set.bases);
+
+        unsafe {
+            let bases: Vec<CppG1Point2> = mem::transmute(test_set.bases);
+            let scalars: Vec<CppFr> = mem::transmute(test_set.scalars);
+
+            let mut msm = ffi::create_g1_msm(degree);
+            let msm_bases = ffi::create_g1_msm_bases_from_point2(&bases);
+
+            // The bases are converted once and shared by the following MSMs.
+            let mut timer = Timer::new();
+            for _ in 0..2 {
+                timer.reset();
+                let actual = ffi::g1_msm_with_bases(&mut *msm, &msm_bases, &scalars);
+                let actual: Box<G1> = mem::transmute(actual);
+                timer.end("msm_with_bases");
+                assert_eq!(*actual, expected);
+            }
+
+            ffi::destroy_g1_msm_bases(msm_bases);
+            ffi::destroy_g1_msm(msm);
+        }
+    }
+
+    #[test]
+    fn test_msm_async() {
+        let degree = 10;
+        let n = 1usize << degree;
+
+        let test_set = TestSet::create(n);
+
+        let expected = best_multiexp(&test_set.scalars, &test_set.bases);
+
+        unsafe {
+            let bases: Vec<CppG1Point2> = mem::transmute(test_set.bases);
+            let scalars: Vec<CppFr> = mem::transmute(test_set.scalars);
+            let msm_bases = ffi::create_g1_msm_bases_from_point2(&bases);
+
+            // Both MSMs are in flight while this thread is free to do other work.
+            let timer = Timer::new();
+            let futures = [
+                G1MSMFuture::from_point2(&bases, &scalars),
+                G1MSMFuture::with_bases(&msm_bases, &scalars),
+            ];
+            for future in futures {
+                let actual: Box<G1> = mem::transmute(block_on(future));
+                assert_eq!(*actual, expected);
+            }
+            timer.end("msm_async");
+
+            ffi::destroy_g1_msm_bases(msm_bases);
+        }
+    }
+
     #[cfg(feature = "gpu")]
     #[test]
     fn test_msm_gpu() {